@@ -1,5 +1,6 @@
 // (c) 2023, Cary Clark cclark2@gmail.com
 #include "OpContour.h"
+#include "OpCoverage.h"
 #include "PathOps.h"
 
 bool PathOps(OpInPath& left, OpInPath& right, OpOperator opOperator, OpOutPath& result
@@ -40,8 +41,28 @@ bool PathOps(OpInPath& left, OpInPath& right, OpOperator opOperator, OpOutPath&
 
 namespace PathOpsV0Lib {
 
+void Cancel(Context* context) {
+    OpContours* contours = (OpContours*) context;
+    contours->cancel = true;
+}
+
 Context* CreateContext(AddContext callerData) {
-    OpContours* contours = new OpContours();
+    return CreateContext(callerData, nullptr, nullptr, nullptr, nullptr);
+}
+
+// the context is allocated before its arena exists, so it is allocated with the hook directly
+Context* CreateContext(AddContext callerData, AllocateMemory allocateFunc, FreeMemory freeFunc,
+        ReallocateMemory reallocateFunc, void* user) {
+    static_assert(alignof(OpContours) <= alignof(std::max_align_t));
+    void* block = allocateFunc ? (*allocateFunc)(user, sizeof(OpContours)) : nullptr;
+    OpContours* contours = block ? new (block) OpContours() : new OpContours();
+    if (block) {
+        contours->contextFree = freeFunc;
+        contours->contextFreeUser = user;
+    }
+    SetMemoryCallBacks((Context*) contours, allocateFunc, freeFunc, reallocateFunc, user);
+    contours->arena.refused = allocateFunc && !block;
+    OpArenaScope scope(contours->arena);
     contours->addCallerData(callerData);
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = contours;
@@ -59,15 +80,48 @@ void Add(AddCurve curve, AddWinding windings) {
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = contour->contours;
 #endif
+    OpArenaScope scope(contour->contours->arena);
+    OpArray<char> snapped;  // copy of caller's data with snapped ends
+    if (contour->contours->snapGrid > 0) {
+        snapped.assign((char*) curve.points, (char*) curve.points + curve.size);
+        OpPoint* pts = (OpPoint*) snapped.data();
+        pts[0] = contour->contours->snap(pts[0]);
+        pts[1] = contour->contours->snap(pts[1]);
+        if (pts[0] == pts[1])
+            return;  // curve is smaller than the grid
+        curve.points = pts;
+    }
+    if (contour->contours->flattenTolerance > 0 && contour->addFlattened(curve, windings))
+        return;
     contour->segments.emplace_back(curve, windings);
 }
 
+void Contains(Context* context, const OpPoint* pts, size_t count, bool* inside) {
+    OpContours* contours = (OpContours*) context;
+    OpArenaScope scope(contours->arena);
+    for (size_t index = 0; index < count; ++index)
+        inside[index] = contours->containsWinding(pts[index]);
+}
+
+void ContainsWinding(Context* context, const OpPoint* pts, size_t count, int* windings) {
+    OpContours* contours = (OpContours*) context;
+    OpArenaScope scope(contours->arena);
+    for (size_t index = 0; index < count; ++index)
+        windings[index] = contours->containsWinding(pts[index]);
+}
+
+ContextCounts Counts(Context* context) {
+    OpContours* contours = (OpContours*) context;
+    return contours->counts;
+}
+
 Contour* CreateContour(AddContour callerData) {
     // reuse existing contour
     OpContours* contours = (OpContours*) callerData.context;
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = contours;
 #endif
+    OpArenaScope scope(contours->arena);
     OpContour* contour = contours->makeContour();
     contour->addCallerData(callerData);
     return (Contour*) contour;
@@ -75,22 +129,40 @@ Contour* CreateContour(AddContour callerData) {
 
 void DeleteContext(Context* context) {
     OpContours* contours = (OpContours*) context;
+    if (contours->resolveThread.joinable()) {
+        // called from the completion callback; the thread does not use the context after that
+        if (std::this_thread::get_id() == contours->resolveThread.get_id())
+            contours->resolveThread.detach();
+        else {
+            contours->cancel = true;
+            contours->resolveThread.join();
+        }
+    }
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = contours;
 #endif
-    delete contours;
+    if (FreeMemory freeFunc = contours->contextFree) {
+        void* user = contours->contextFreeUser;
+        contours->~OpContours();
+        (*freeFunc)(user, contours);
+    } else
+        delete contours;
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = nullptr;
 #endif
 }
 
-int Error(Context* context) {
-#if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
+ContextError Error(Context* context) {
     OpContours* contours = (OpContours*) context;
+#if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = contours;
 #endif
-    // !!! incomplete
-    return 0;
+    return contours->error;
+}
+
+ContextMemory Memory(Context* context) {
+    OpContours* contours = (OpContours*) context;
+    return contours->arena.memory();
 }
 
 void Resolve(Context* context, PathOutput output) {
@@ -99,15 +171,122 @@ void Resolve(Context* context, PathOutput output) {
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = contours;
 #endif
-    // !!! change this to record error instead of success
-    /* bool success = */ contours->pathOps();
+    OpArenaScope scope(contours->arena);
+    (void) contours->pathOps();  // failure is recorded for Error()
+}
+
+// the thread is kept by the context, rather than by the future, so that discarding the future
+// does not wait for the resolve; the next resolve async or delete context joins it
+std::future<ContextError> ResolveAsync(Context* context, PathOutput output, 
+        ResolveComplete complete) {
+    OpContours* contours = (OpContours*) context;
+    if (contours->resolveThread.joinable()) {
+        if (std::this_thread::get_id() == contours->resolveThread.get_id())
+            contours->resolveThread.detach();  // called from the completion callback
+        else {
+            // a cancel already pending is kept for this resolve if the previous one had finished
+            bool pending = contours->cancel.exchange(true);
+            contours->resolveThread.join();
+            if (!pending)
+                contours->cancel = false;
+        }
+    }
+    std::promise<ContextError> promise;
+    std::future<ContextError> result = promise.get_future();
+    // the thread waits until resolve thread is set, so that the completion callback may find it
+    std::promise<void> threadSet;
+    std::future<void> threadReady = threadSet.get_future();
+    contours->resolveThread = std::thread([context, output, complete]
+            (std::promise<ContextError> done, std::future<void> ready) {
+        ready.wait();
+        Resolve(context, output);
+        ContextError error = Error(context);
+        if (complete)
+            (*complete)(context, output, error);
+        done.set_value(error);
+    }, std::move(promise), std::move(threadReady));
+    threadSet.set_value();
+    return result;
+}
+
+bool ResolveStep(Context* context, PathOutput output, size_t budget) {
+    OpContours* contours = (OpContours*) context;
+    contours->callerOutput = output;
+#if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
+    debugGlobalContours = contours;
+#endif
+    OpArenaScope scope(contours->arena);
+    return contours->resolveStep(budget);
 }
 
 void SetContextCallBacks(Context* context, EmptyNativePath emptyNativePath) {
     OpContours* contours = (OpContours*) context;
-    contours->contextCallBacks = {
-        emptyNativePath
-    };
+    contours->contextCallBacks.emptyNativePath = emptyNativePath;
+}
+
+void SetContourNesting(Context* context, ContourNesting nestingFunc) {
+    OpContours* contours = (OpContours*) context;
+    contours->contourNesting = nestingFunc;
+}
+
+void SetCoverageOutput(Context* context, const CoverageMask& mask) {
+    OpContours* contours = (OpContours*) context;
+    contours->coverageMask = mask;
+    contours->flatTolerance = OpCoverage::Tolerance(mask);
+}
+
+void SetFlattenInput(Context* context, OpType lineType, float tolerance) {
+    OpContours* contours = (OpContours*) context;
+    contours->flattenLineType = lineType;
+    contours->flattenTolerance = tolerance;
+}
+
+void SetSnapGrid(Context* context, float gridSize) {
+    OpContours* contours = (OpContours*) context;
+    contours->snapGrid = gridSize;
+}
+
+void SetMeasureOutput(Context* context, MeasureOutput measureFunc, float tolerance) {
+    OpContours* contours = (OpContours*) context;
+    contours->measureOutput = measureFunc;
+    contours->measureTolerance = tolerance;
+}
+
+void SetMemoryCallBacks(Context* context, AllocateMemory allocateFunc, FreeMemory freeFunc,
+        void* user) {
+    SetMemoryCallBacks(context, allocateFunc, freeFunc, nullptr, user);
+}
+
+void SetMemoryCallBacks(Context* context, AllocateMemory allocateFunc, FreeMemory freeFunc,
+        ReallocateMemory reallocateFunc, void* user) {
+    OpContours* contours = (OpContours*) context;
+    contours->contextCallBacks.allocateMemory = allocateFunc;
+    contours->contextCallBacks.freeMemory = freeFunc;
+    contours->contextCallBacks.reallocateMemory = reallocateFunc;
+    contours->contextCallBacks.memoryUser = user;
+}
+
+void SetMeshOutput(Context* context, MeshOutput meshFunc, float tolerance) {
+    OpContours* contours = (OpContours*) context;
+    contours->meshOutput = meshFunc;
+    contours->flatTolerance = tolerance;
+}
+
+void SetOutputDone(Context* context, OutputDone outputDone) {
+    OpContours* contours = (OpContours*) context;
+    contours->contextCallBacks.outputDone = outputDone;
+}
+
+void SetContextLimits(Context* context, ContextLimits limits) {
+    OpContours* contours = (OpContours*) context;
+    contours->limits = limits;
+    contours->arena.maxBytes = limits.maxBytes;
+}
+
+void SetCallerDataAlignment(Context* context, size_t alignment) {
+    OpContours* contours = (OpContours*) context;
+    OP_ASSERT(alignment && !(alignment & (alignment - 1)));
+    contours->callerAlign = alignment;
 }
 
 OpType SetCurveCallBacks(Context* context, AxisRawHit axisFunc, ControlNearlyEnd nearlyFunc,
@@ -121,16 +300,27 @@ OpType SetCurveCallBacks(Context* context, AxisRawHit axisFunc, ControlNearlyEnd
 		OP_DEBUG_IMAGE_PARAMS(DebugAddToPath debugAddToPathFunc)
 ) {
     OpContours* contours = (OpContours*) context;
+    OpArenaScope scope(contours->arena);
     contours->callBacks.push_back( { axisFunc, nearlyFunc, hullFunc, isFiniteFunc, isLineFunc, 
             isLinearFunc, setBoundsFunc, normalFunc, outputFunc, curvePinFunc, reverseFunc, 
             tangentFunc, equalFunc, ptAtTFunc, doublePtAtTFunc, ptCountFunc, rotateFunc, 
-            subDivideFunc, xyAtTFunc 
+            subDivideFunc, xyAtTFunc, nullptr, nullptr
 		    OP_DEBUG_DUMP_PARAMS(debugDumpExtraFunc)
 		    OP_DEBUG_IMAGE_PARAMS(debugAddToPathFunc)
             } );
     return (OpType) contours->callBacks.size();
 }
 
+void SetCurveArea(Context* context, OpType type, CurveArea areaFunc) {
+    OpContours* contours = (OpContours*) context;
+    contours->callBack(type).curveAreaFuncPtr = areaFunc;
+}
+
+void SetPtAtTBatch(Context* context, OpType type, PtAtTBatch batchFunc) {
+    OpContours* contours = (OpContours*) context;
+    contours->callBack(type).ptAtTBatchFuncPtr = batchFunc;
+}
+
 void SetWindingCallBacks(Contour* ctour, WindingAdd addFunc, WindingKeep keepFunc,
         WindingSubtract subtractFunc, WindingVisible visibleFunc, WindingZero zeroFunc
 		OP_DEBUG_DUMP_PARAMS(DebugDumpContourIn dumpInFunc, DebugDumpContourOut dumpOutFunc, 
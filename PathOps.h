@@ -8,6 +8,7 @@
 
 enum class OpFill;
 
+#include <future>
 #if OP_DEBUG
 #include <vector>
 #endif
@@ -86,28 +87,150 @@ namespace PathOpsV0Lib {
  */
 void Add(AddCurve , AddWinding );
 
+/* Stops a resolve in progress; safe to call from another thread. Resolve() returns early and 
+   Error() returns ContextError::cancelled. If no resolve is in progress, stops the next one.
+ */
+void Cancel(Context* );
+
 /* Makes a PathOps context: an instance of the PathOps engine. Optional caller data may be added.
  */
 Context* CreateContext(AddContext );
 
-/* Deletes a PathOps context, and frees any memory associated with that context.
+/* Like CreateContext(), but allocates all of the context's memory with the caller's functions,
+   including the context itself and its copy of the caller data. See SetMemoryCallBacks().
+ */
+Context* CreateContext(AddContext , AllocateMemory , FreeMemory , ReallocateMemory , 
+        void* user);
+
+/* Deletes a PathOps context, and frees any memory associated with that context. If a resolve
+   started by ResolveAsync() is running, cancels it and waits for it to stop.
  */
 void DeleteContext(Context* );
 
+/* Sets whether each point is inside the result. Call after Resolve() has completed. The first
+   call indexes the output curves by height, so later calls only test curves near each point.
+   Output contours may turn either way, so a point is inside if a ray from it crosses the
+   output an odd number of times.
+ */
+void Contains(Context* , const OpPoint* pts, size_t count, bool* inside);
+
+/* Like Contains(), but sets the winding of the result around each point: zero if outside,
+   and otherwise one or minus one depending on the direction of the outermost output contour
+   enclosing the point. Holes, and contours within holes, count as turning opposite to the
+   contour enclosing them, as found by the output contour nesting.
+ */
+void ContainsWinding(Context* , const OpPoint* pts, size_t count, int* windings);
+
 /* Makes a PathOps contour: a collection of curves. Optional caller data may be added.
  */
 Contour* CreateContour(AddContour );
 
 /* returns error code of previous call
  */
-int Error(Context* );
+ContextError Error(Context* );
+
+/* Returns how often the previous Resolve() fell back to retries and approximations.
+ */
+ContextCounts Counts(Context* );
+
+/* Returns the bytes the context holds, by what they hold. Storage is freed only when the
+   context is deleted; storage released while resolving is reused by the same context. Bytes
+   taken from the global heap because the memory callback refused them, or because they
+   would pass ContextLimits::maxBytes, are summed in overflow.
+ */
+ContextMemory Memory(Context* );
 
 /* Operate on curves provided by Add(). Calls curve output callback with path output.
+   Each contour is output as soon as it is closed, while the remaining edges are still being
+   joined; the curve output callback's last point flag marks the end of each contour. Calls
+   the output done callback, if set, when no more contours will follow. Resolving the same context again
+   starts over from the curves as they were added, including any added since, and clears Error().
  */
 void Resolve(Context* , PathOutput );
 
+/* Like Resolve(), but does at most budget units of work before returning. Call again with the
+   same context to continue. Returns true once the output is complete (or the op has failed);
+   the next call starts a new resolve.
+ */
+bool ResolveStep(Context* , PathOutput , size_t budget);
+
+/* Like Resolve(), but runs on a separate thread and returns immediately. When done, calls the
+   optional completion callback (on that thread) and sets the future's error. Until then, only
+   Cancel() and DeleteContext() may be called with the context. DeleteContext() cancels the
+   resolve and waits for its thread to finish; it may also be called from the completion
+   callback. Calling ResolveAsync() again cancels the previous resolve if it is still running,
+   and waits for it to stop.
+ */
+std::future<ContextError> ResolveAsync(Context* , PathOutput , ResolveComplete );
+
 void SetContextCallBacks(Context* ,  EmptyNativePath);
 
+/* Optionally calls output done once resolve has output the last contour, or has failed. Pass
+   nullptr to turn off.
+ */
+void SetOutputDone(Context* , OutputDone );
+
+/* Allocates the context's memory with the caller's functions instead of the global heap. user
+   is passed to each. Memory allocated before this call is freed with the functions in effect
+   when it was allocated. Reallocate is optional. The context and its caller data are allocated
+   by CreateContext(); to allocate those with the caller's functions as well, pass them to
+   CreateContext() instead. To cap the context's memory, see ContextLimits.
+ */
+void SetMemoryCallBacks(Context* , AllocateMemory , FreeMemory , void* user);
+void SetMemoryCallBacks(Context* , AllocateMemory , FreeMemory , ReallocateMemory , void* user);
+
+/* Optionally reports, for each output contour, the contour that encloses it and how deeply it
+   is nested. Computed from the windings and rays found while resolving, so the caller need not
+   test output contours against each other to find holes. Pass nullptr to turn off.
+ */
+void SetContourNesting(Context* , ContourNesting );
+
+/* Outputs the result as an indexed triangle mesh instead of calling curve output. Curves are
+   approximated by lines no farther than tolerance from the curve. Each triangle is three
+   indices into vertices. Adjacent triangles share whole sides, so no vertex lies partway along
+   a side. Pass nullptr to restore curve output.
+ */
+void SetMeshOutput(Context* , MeshOutput , float tolerance);
+
+/* Approximates curves added after this call with lines no farther than tolerance from the
+   curve, so that the faster line intersection paths are used. Line type must be a curve type
+   whose callbacks describe a line. Pass zero tolerance to turn off.
+ */
+void SetFlattenInput(Context* , OpType lineType, float tolerance);
+
+/* Rounds the ends of curves added after this call, and all intersections found while resolving,
+   to multiples of grid size. Near misses of ends then either meet exactly or are at least one
+   grid apart, so fewer retries and fallbacks are needed. Output curves are reshaped to end at
+   the rounded intersections, so every output curve starts and ends on the grid; a part that
+   rounds to a point is dropped. Pass zero to turn off.
+ */
+void SetSnapGrid(Context* , float gridSize);
+
+/* Outputs the area, perimeter and bounds of the result instead of calling curve output. Area
+   uses the curve area callback where set, and otherwise, like the perimeter, approximates
+   curves with lines no farther than tolerance from the curve. Pass nullptr to restore curve
+   output.
+ */
+void SetMeasureOutput(Context* , MeasureOutput , float tolerance);
+
+/* Writes anti-aliased coverage of the result into the mask instead of calling curve output.
+   Pixels outside the result are set to zero. Pass a mask with null pixels to restore curve
+   output.
+ */
+void SetCoverageOutput(Context* , const CoverageMask& );
+
+/* Sets limits on the work Resolve() may do. Exceeding a limit stops Resolve() and sets Error().
+   Limits are checked between units of work; max bytes is also checked as each block is
+   allocated, so the context's memory passes it by at most what one unit allocates.
+ */
+void SetContextLimits(Context* , ContextLimits );
+
+/* Aligns contour and winding data copied from the caller to a multiple of alignment, which
+   must be a power of two. Defaults to the alignment of a pointer. Context data is copied by
+   CreateContext(), before this can be called; it is always maximally aligned.
+ */
+void SetCallerDataAlignment(Context* , size_t alignment);
+
 OpType SetCurveCallBacks(Context* , AxisRawHit, ControlNearlyEnd,
 		CurveHull, CurveIsFinite, CurveIsLine, CurveIsLinear,
 		SetBounds, CurveNormal, CurveOutput, CurvePinCtrl,
@@ -117,6 +240,16 @@ OpType SetCurveCallBacks(Context* , AxisRawHit, ControlNearlyEnd,
 		OP_DEBUG_IMAGE_PARAMS(DebugAddToPath)
 	);
 
+/* Optional: computes the area contribution of a curve type exactly (see CurveArea).
+ */
+void SetCurveArea(Context* , OpType , CurveArea );
+
+/* Optional: evaluates several parameters of a curve type in one call (see PtAtTBatch), so the
+   curve's control data is read once. The engine mostly evaluates two parameters at a time; the
+   line, quad, conic and cubic batch functions evaluate each pair with one set of SIMD ops.
+ */
+void SetPtAtTBatch(Context* , OpType , PtAtTBatch );
+
 void SetWindingCallBacks(Contour* , WindingAdd, WindingKeep ,
 		WindingSubtract , WindingVisible, WindingZero
 		OP_DEBUG_DUMP_PARAMS(DebugDumpContourIn, DebugDumpContourOut, DebugDumpContourExtra)
@@ -100,6 +100,71 @@ struct AddWinding {
 // output path provided by caller
 typedef void* PathOutput;
 
+// returned by Error()
+enum class ContextError {
+	none,
+	intersection,	// curve intersections could not be computed
+	winding,		// edge windings could not be computed
+	assemble,		// edges could not be joined into output contours
+	segmentLimit,	// more segments than allowed by limits
+	edgeLimit,		// more edges than allowed by limits
+	curveCurveLimit,  // curve/curve intersection went deeper than allowed by limits
+	limbLimit,		// search for closing contour tried more paths than allowed by limits
+	timeLimit,		// resolve took longer than allowed by limits
+	memoryLimit,	// context memory grew beyond limits, or allocate memory returned null
+	cancelled		// Cancel() was called
+};
+
+// caps on the work Resolve() may do before failing; zero means no limit
+struct ContextLimits {
+	size_t maxSegments;
+	size_t maxEdges;
+	int maxCurveCurveDepth;  // values larger than the engine's own limit (64) have no effect
+	int maxLimbs;
+	int maxMilliseconds;  // wall clock time from the first call to Resolve(); read every 64 units
+	size_t maxBytes;  // context memory, as reported by Memory().reserved; see AllocateMemory
+};
+
+// how often Resolve() fell back to a slower or less exact path; reset by each Resolve()
+struct ContextCounts {
+	int rayRetries;  // ray intercepts retried from a different center
+	int curveCurveFallbacks;  // curve/curve failures searched for small distances instead
+	int aliases;  // end points treated as equal to nearby points
+	int smallSegments;  // segments disabled because their aliased ends are equal
+	int floatRoots;  // polynomials whose roots were certified in float
+	int doubleRoots;  // polynomials solved again in double because float was ill-conditioned
+};
+
+// memory held by a context, in bytes, by what it holds
+struct ContextMemory {
+	size_t contours;
+	size_t curveData;  // points and weights of segment and edge curves
+	size_t edges;
+	size_t intersections;
+	size_t limbs;  // joiner search tree
+	size_t callerData;  // context, contour and winding data
+	size_t containers;  // lists of segments, edges, intersections and the like
+	size_t resolve;  // state kept between calls to resolve step, and the contains index
+	size_t reserved;  // bytes obtained from the system and not yet returned
+	size_t allocations;  // count of container blocks allocated, including those since freed
+	size_t overflow;  // bytes taken from the global heap after a refusal, including those since freed
+};
+
+// 8-bit coverage written in place of curve output; 0 is empty and 255 is fully covered
+// output points map to pixels as (x * scaleX + y * skewX + transX, x * skewY + y * scaleY + transY)
+struct CoverageMask {
+	uint8_t* pixels;  // caller allocated; rowBytes * height bytes
+	int width;
+	int height;
+	size_t rowBytes;
+	float scaleX;
+	float skewX;
+	float transX;
+	float skewY;
+	float scaleY;
+	float transY;
+};
+
 // callbacks
 
 #if 0
@@ -165,6 +230,13 @@ typedef void (*SetBounds)(Curve , OpRect& );
 // returns either x or y pair at parameter t, where: t=0 is start, t=1 is end
 typedef OpPair (*XYAtT)(Curve , OpPair t, XyChoice );
 
+// returns half of x dy - y dx integrated along the curve; the sum around a closed contour is
+// the contour's signed area
+typedef float (*CurveArea)(Curve );
+
+// sets the point at each of count parameters t; must match PtAtT for each t
+typedef void (*PtAtTBatch)(Curve , const float* t, OpPoint* pts, size_t count);
+
 #if OP_DEBUG_DUMP
 // describes caller data for debugging (does not include points: e.g., a rational Bezier weight)
 typedef std::string (*DebugDumpCurveExtra)(Curve , DebugLevel , DebugBase);
@@ -195,6 +267,8 @@ struct CurveCallBacks {
 	Rotate rotateFuncPtr;
 	SubDivide subDivideFuncPtr;
 	XYAtT xyAtTFuncPtr;
+	CurveArea curveAreaFuncPtr;  // optional; set by SetCurveArea()
+	PtAtTBatch ptAtTBatchFuncPtr;  // optional; set by SetPtAtTBatch()
 #if OP_DEBUG_DUMP
 	DebugDumpCurveExtra debugDumpCurveExtraFuncPtr;
 #endif
@@ -250,8 +324,56 @@ struct ContourCallBacks {
 
 typedef void (*EmptyNativePath)(PathOutput );
 
+// called once after the last contour is output, or after resolve fails (see Error())
+typedef void (*OutputDone)(PathOutput );
+
+// called once per output contour, before output done; contours are numbered in output order.
+// parent is the index of the innermost contour enclosing this one, or -1 if there is none;
+// depth is the number of contours enclosing this one (zero for outer contours). Nesting comes
+// from the rays found while resolving; a contour that no ray reached is tested with a point on it
+// against the other output contours instead
+typedef void (*ContourNesting)(PathOutput , int contour, int parent, int depth);
+
+// measures of the output contours; holes are subtracted from area and added to perimeter
+struct OutputMeasures {
+	OpRect bounds;
+	float area;
+	float perimeter;
+};
+
+// called once with measures of the result, in place of curve output
+typedef void (*MeasureOutput)(PathOutput , const OutputMeasures& );
+
+// called once with the triangles that fill the output, in place of curve output
+typedef void (*MeshOutput)(PathOutput , const OpPoint* vertices, size_t vertexCount, 
+		const uint32_t* indices, size_t indexCount);
+
+// called from the worker thread when ResolveAsync() finishes
+typedef void (*ResolveComplete)(Context* , PathOutput , ContextError );
+
+// optional; replaces the global heap for the context's memory. Returns size bytes, aligned
+// for any type, or null to refuse. It is not called for a block that would take the context's
+// memory past ContextLimits::maxBytes; that block is refused instead. The engine cannot stop
+// in the middle of a unit of work, so a refused block is taken from the global heap, counted
+// in Memory().overflow, and Resolve() stops with ContextError::memoryLimit at the end of the
+// unit. user is the pointer passed to SetMemoryCallBacks() or CreateContext()
+typedef void* (*AllocateMemory)(void* user, size_t size);
+
+// frees a block returned by allocate memory
+typedef void (*FreeMemory)(void* user, void* block);
+
+// optional; resizes a block returned by allocate memory, keeping its contents up to the
+// smaller size, and returns it, possibly moved. Returns null to refuse, leaving block as it
+// was; the engine then allocates, copies and frees instead. Used for lists that grow in place
+typedef void* (*ReallocateMemory)(void* user, void* block, size_t size);
+
 struct ContextCallBacks {
 	EmptyNativePath emptyNativePath;
+	OutputDone outputDone;
+	AllocateMemory allocateMemory;  // null uses the global heap
+	FreeMemory freeMemory;
+	ReallocateMemory reallocateMemory;  // null allocates, copies and frees
+	void* memoryUser;
 };
 
 #if OP_DEBUG_DUMP
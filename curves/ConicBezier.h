@@ -197,6 +197,36 @@ inline OpPoint conicPtAtT(Curve c, float t) {
     return ConicPointAtT(c.data->start, control, c.data->end, t);
 }
 
+// evaluates two t per step; the numerator and denominator coefficients are found once, as
+// conic numer and conic denom find them, and each lane then computes what they do
+inline void conicPtAtTBatch(Curve c, const float* t, OpPoint* pts, size_t count) {
+    PointWeight control(c);
+    size_t index = 0;
+#if OP_SIMD
+    OpPoint pt1w = control.pt * control.weight;
+    OpPoint numerA = c.data->end - 2 * pt1w + c.data->start;
+    OpPoint numerB = 2 * (pt1w - c.data->start);
+    float denomB = 2 * (control.weight - 1);
+    OpSimd::Rect aN = OpSimd::Set(numerA.x, numerA.y);
+    OpSimd::Rect bN = OpSimd::Set(numerB.x, numerB.y);
+    OpSimd::Rect cN = OpSimd::Set(c.data->start.x, c.data->start.y);
+    OpSimd::Rect aD = OpSimd::Splat(-denomB);
+    OpSimd::Rect bD = OpSimd::Splat(denomB);
+    OpSimd::Rect one = OpSimd::Splat(1);
+    for (; index + 1 < count; index += 2) {
+        OpSimd::Rect tt = OpSimd::Spread(t[index], t[index + 1]);
+        OpSimd::Rect numer = OpSimd::Add(OpSimd::Mul(OpSimd::Add(OpSimd::Mul(aN, tt), bN), tt), 
+                cN);
+        OpSimd::Rect denom = OpSimd::Add(OpSimd::Mul(OpSimd::Add(OpSimd::Mul(aD, tt), bD), tt), 
+                one);
+        OpSimd::StorePair(&pts[index].x, OpSimd::Div(numer, denom), &t[index], 
+                &c.data->start.x, &c.data->end.x);
+    }
+#endif
+    for (; index < count; ++index)
+        pts[index] = ConicPointAtT(c.data->start, control, c.data->end, t[index]);
+}
+
 inline OpPair conicXYAtT(Curve c, OpPair t, XyChoice xyChoice) {
     PointWeight control(c);
     return ConicXYAtT(c.data->start, control, c.data->end, t, xyChoice);
@@ -208,6 +238,24 @@ inline bool conicsEqual(Curve one, Curve two) {
     return ctrl1.pt == ctrl2.pt && ctrl1.weight == ctrl2.weight;
 }
 
+// the area between a conic and its chord is a fraction of its hull triangle's area; the
+// fraction is two thirds for a weight of one (a quad) and less for smaller weights
+inline float conicArea(Curve c) {
+    PointWeight control(c);
+    double w = control.weight;
+    double fraction;
+    if (fabs(w - 1) < 1e-3)  // avoid dividing by nearly zero
+        fraction = 2. / 3 + 4. / 15 * (w - 1);
+    else if (w < 1)
+        fraction = w / (1 - w * w) * (acos(w) / sqrt(1 - w * w) - w);
+    else
+        fraction = w / (w * w - 1) * (w - acosh(w) / sqrt(w * w - 1));
+    OpVector start(c.data->start);
+    OpVector ctrl = control.pt - c.data->start;
+    OpVector end = c.data->end - c.data->start;
+    return (start.cross(OpVector(c.data->end)) + ctrl.cross(end) * (float) fraction) / 2;
+}
+
 inline OpVector conicTangent(Curve c, float t) {
     PointWeight control(c);
     return ConicTangent(c.data->start, control, c.data->end, t);
@@ -89,19 +89,10 @@ inline OpRoots CubicAxisRawHit(OpPoint start, CubicControls controls, OpPoint en
     A -= D - C + B;     // A =   -a + 3*b - 3*c + d
     B += 3 * D - 2 * C; // B =  3*a - 6*b + 3*c
     C -= 3 * D;         // C = -3*a + 3*b
-    return OpMath::CubicRootsReal(A, B, C, D - axisIntercept, MatchEnds::none);
+    return OpMath::CubicRoots(A, B, C, D - axisIntercept, MatchEnds::none);
 }
 
 inline OpVector CubicTangent(OpPoint start, CubicControls controls, OpPoint end, float t) {
-    // !!! document why this needs to be double (include example test requiring it)
-    auto tangent = [start, controls, end](XyChoice offset, double t) {
-        double one_t = 1 - t;
-        double a = start.choice(offset);
-        double b = controls.pts[0].choice(offset);
-        double c = controls.pts[1].choice(offset);
-        double d = end.choice(offset);
-        return (float) (3 * ((b - a) * one_t * one_t + 2 * (c - b) * t * one_t + (d - c) * t * t));
-    };
     if (0 == t && start == controls.pts[0]) {
         if (controls.pts[0] == controls.pts[1])
             return end - start;
@@ -114,7 +105,16 @@ inline OpVector CubicTangent(OpPoint start, CubicControls controls, OpPoint end,
         else
             return end - controls.pts[0];
     }
-    return { tangent(XyChoice::inX, t), tangent(XyChoice::inY, t) };
+    // !!! document why this needs to be double (include example test requiring it)
+    OpPointOf<double> a(start);
+    OpPointOf<double> b(controls.pts[0]);
+    OpPointOf<double> c(controls.pts[1]);
+    OpPointOf<double> d(end);
+    double dt = t;
+    double one_t = 1 - dt;
+    OpVectorOf<double> tangent = 3 * ((b - a) * one_t * one_t + 2 * (c - b) * dt * one_t 
+            + (d - c) * dt * dt);
+    return OpVector(tangent);
 }
 
 // Curves must be subdivided so their endpoints describe the rectangle that contains them
@@ -192,6 +192,35 @@ inline OpPoint cubicPtAtT(Curve c, float t) {
     return CubicPointAtT(c.data->start, controls, c.data->end, t);
 }
 
+// evaluates two t per step; each lane computes what cubic point at t does, in the same order
+inline void cubicPtAtTBatch(Curve c, const float* t, OpPoint* pts, size_t count) {
+    CubicControls controls(c);
+    size_t index = 0;
+#if OP_SIMD
+    OpSimd::Rect start = OpSimd::Set(c.data->start.x, c.data->start.y);
+    OpSimd::Rect ctrl1 = OpSimd::Set(controls.pts[0].x, controls.pts[0].y);
+    OpSimd::Rect ctrl2 = OpSimd::Set(controls.pts[1].x, controls.pts[1].y);
+    OpSimd::Rect end = OpSimd::Set(c.data->end.x, c.data->end.y);
+    OpSimd::Rect one = OpSimd::Splat(1);
+    OpSimd::Rect three = OpSimd::Splat(3);
+    for (; index + 1 < count; index += 2) {
+        OpSimd::Rect tt = OpSimd::Spread(t[index], t[index + 1]);
+        OpSimd::Rect one_t = OpSimd::Sub(one, tt);
+        OpSimd::Rect one_t2 = OpSimd::Mul(one_t, one_t);
+        OpSimd::Rect a = OpSimd::Mul(one_t2, one_t);
+        OpSimd::Rect b = OpSimd::Mul(OpSimd::Mul(three, one_t2), tt);
+        OpSimd::Rect t2 = OpSimd::Mul(tt, tt);
+        OpSimd::Rect d = OpSimd::Mul(OpSimd::Mul(three, one_t), t2);
+        OpSimd::Rect e = OpSimd::Mul(t2, tt);
+        OpSimd::Rect result = OpSimd::Add(OpSimd::Add(OpSimd::Add(OpSimd::Mul(a, start), 
+                OpSimd::Mul(b, ctrl1)), OpSimd::Mul(d, ctrl2)), OpSimd::Mul(e, end));
+        OpSimd::StorePair(&pts[index].x, result, &t[index], &c.data->start.x, &c.data->end.x);
+    }
+#endif
+    for (; index < count; ++index)
+        pts[index] = CubicPointAtT(c.data->start, controls, c.data->end, t[index]);
+}
+
 inline OpPair cubicXYAtT(Curve c, OpPair t, XyChoice xyChoice) {
     CubicControls controls(c);
     return CubicXYAtT(c.data->start, controls, c.data->end, t, xyChoice);
@@ -205,6 +234,18 @@ inline bool cubicsEqual(Curve one, Curve two) {
             : ctrlPt1.pts[0] == ctrlPt2.pts[1] && ctrlPt1.pts[1] == ctrlPt2.pts[0];
 }
 
+// half of x dy - y dx integrated along the cubic
+inline float cubicArea(Curve c) {
+    CubicControls controls(c);
+    OpPoint p0 = c.data->start;
+    OpPoint p1 = controls.pts[0];
+    OpPoint p2 = controls.pts[1];
+    OpPoint p3 = c.data->end;
+    return 3 * ((p3.y - p0.y) * (p1.x + p2.x) - (p3.x - p0.x) * (p1.y + p2.y)
+            + p1.y * (p0.x - p2.x) - p1.x * (p0.y - p2.y)
+            + p3.y * (p2.x + p0.x / 3) - p3.x * (p2.y + p0.y / 3)) / 20;
+}
+
 inline OpVector cubicTangent(Curve c, float t) {
     CubicControls controls(c);
     return CubicTangent(c.data->start, controls, c.data->end, t);
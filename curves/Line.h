@@ -37,6 +37,24 @@ inline OpPoint linePtAtT(PathOpsV0Lib::Curve c, float t) {
     return OpPoint();
 }
 
+// evaluates two t per step; each lane computes what line pt at t does, in the same order
+inline void linePtAtTBatch(PathOpsV0Lib::Curve c, const float* t, OpPoint* pts, size_t count) {
+    size_t index = 0;
+#if OP_SIMD
+    OpSimd::Rect start = OpSimd::Set(c.data->start.x, c.data->start.y);
+    OpSimd::Rect end = OpSimd::Set(c.data->end.x, c.data->end.y);
+    OpSimd::Rect one = OpSimd::Splat(1);
+    for (; index + 1 < count; index += 2) {
+        OpSimd::Rect tt = OpSimd::Spread(t[index], t[index + 1]);
+        OpSimd::Rect result = OpSimd::Add(OpSimd::Mul(OpSimd::Sub(one, tt), start), 
+                OpSimd::Mul(tt, end));
+        OpSimd::StorePair(&pts[index].x, result, &t[index], &c.data->start.x, &c.data->end.x);
+    }
+#endif
+    for (; index < count; ++index)
+        pts[index] = linePtAtT(c, t[index]);
+}
+
 inline OpPair lineXYAtT(PathOpsV0Lib::Curve c, OpPair t, XyChoice xyChoice) {
     return (1 - t) * c.data->start.choice(xyChoice) + t * c.data->end.choice(xyChoice);
 }
@@ -45,6 +63,11 @@ inline bool linesEqual(PathOpsV0Lib::Curve , PathOpsV0Lib::Curve ) {
     return true;
 }
 
+// half of x dy - y dx integrated along the line
+inline float lineArea(PathOpsV0Lib::Curve c) {
+    return OpVector(c.data->start).cross(OpVector(c.data->end)) / 2;
+}
+
 inline OpVector lineTangent(PathOpsV0Lib::Curve c, float ) {
     return c.data->end - c.data->start;
 }
@@ -133,6 +133,32 @@ inline OpPoint quadPtAtT(Curve c, float t) {
     return QuadPointAtT(c.data->start, quadControlPt(c), c.data->end, t);
 }
 
+// control point is read once for all t; evaluates two t per step, where each lane computes
+// what quad point at t does, in the same order, so that the points are the same
+inline void quadPtAtTBatch(Curve c, const float* t, OpPoint* pts, size_t count) {
+    OpPoint control = quadControlPt(c);
+    size_t index = 0;
+#if OP_SIMD
+    OpSimd::Rect start = OpSimd::Set(c.data->start.x, c.data->start.y);
+    OpSimd::Rect ctrl = OpSimd::Set(control.x, control.y);
+    OpSimd::Rect end = OpSimd::Set(c.data->end.x, c.data->end.y);
+    OpSimd::Rect one = OpSimd::Splat(1);
+    OpSimd::Rect two = OpSimd::Splat(2);
+    for (; index + 1 < count; index += 2) {
+        OpSimd::Rect tt = OpSimd::Spread(t[index], t[index + 1]);
+        OpSimd::Rect one_t = OpSimd::Sub(one, tt);
+        OpSimd::Rect a = OpSimd::Mul(one_t, one_t);
+        OpSimd::Rect b = OpSimd::Mul(OpSimd::Mul(two, one_t), tt);
+        OpSimd::Rect d = OpSimd::Mul(tt, tt);
+        OpSimd::Rect result = OpSimd::Add(OpSimd::Add(OpSimd::Mul(a, start), 
+                OpSimd::Mul(b, ctrl)), OpSimd::Mul(d, end));
+        OpSimd::StorePair(&pts[index].x, result, &t[index], &c.data->start.x, &c.data->end.x);
+    }
+#endif
+    for (; index < count; ++index)
+        pts[index] = QuadPointAtT(c.data->start, control, c.data->end, t[index]);
+}
+
 inline OpPair quadXYAtT(Curve c, OpPair t, XyChoice xyChoice) {
     return QuadXYAtT(c.data->start, quadControlPt(c), c.data->end, t, xyChoice);
 }
@@ -143,6 +169,14 @@ inline bool quadsEqual(Curve one, Curve two) {
     return ctrlPt1 == ctrlPt2;
 }
 
+// the area between a quad and its chord is two thirds of its hull triangle's area
+inline float quadArea(Curve c) {
+    OpVector start(c.data->start);
+    OpVector control = quadControlPt(c) - c.data->start;
+    OpVector end = c.data->end - c.data->start;
+    return (start.cross(OpVector(c.data->end)) + control.cross(end) * 2 / 3) / 2;
+}
+
 inline OpVector quadTangent(Curve c, float t) {
     return QuadTangent(c.data->start, quadControlPt(c), c.data->end, t);
 }
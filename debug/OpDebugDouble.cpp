@@ -951,6 +951,7 @@ void DebugOpDrawSegments() {
 
 DebugOpCurve OpEdge::debugSetCurve() const {
     DebugOpCurve dCurve;
+    const OpCurve& curve = this->curve();
     for (int i = 0; i < curve.pointCount(); ++i)
         dCurve.pts[i] = { curve.hullPt(i).x, curve.hullPt(i).y } ;
     // !!! missing conic weight for now
@@ -1365,13 +1366,13 @@ void DebugOpDrawEdgeID(const OpEdge* edge, uint32_t color) {
 void DebugOpDrawEdgeControlLines(const OpEdge* edge, uint32_t color) {
     if (!edge->segment)
         return;
-    int ptCount = edge->curve.pointCount();
+    int ptCount = edge->curve().pointCount();
     if (ptCount <= 2)
         return;
     for (int index = 0; index < ptCount - 1; ++index) {
         DebugOpCurve src;
-        src.pts[0] = { edge->curve.hullPt(index).x, edge->curve.hullPt(index).y };
-        src.pts[1] = { edge->curve.hullPt(index + 1).x, edge->curve.hullPt(index + 1).y };
+        src.pts[0] = { edge->curve().hullPt(index).x, edge->curve().hullPt(index).y };
+        src.pts[1] = { edge->curve().hullPt(index + 1).x, edge->curve().hullPt(index + 1).y };
         src.weight = 1;
         src.type = OpType::line;
         src.id = edge->id;
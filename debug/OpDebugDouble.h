@@ -14,7 +14,8 @@ struct OpCubic;
 struct OpIntersection;
 struct OpInPath;
 struct OpOutPath;
-struct OpPoint;
+template <typename T> struct OpPointOf;
+typedef OpPointOf<float> OpPoint;
 struct OpPointBounds;
 struct OpDebugRay;
 struct OpSegment;
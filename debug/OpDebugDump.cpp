@@ -46,6 +46,7 @@ DebugLevel defaultLevel = DebugLevel::normal;
 			dmpHex(thing); \
 	}
 	VECTOR_STRUCTS
+	SCALAR_VECTOR_STRUCTS
 #undef OP_X
 #define OP_X(Thing) \
 	void dmp(const std::vector<Thing>& things) { \
@@ -66,6 +67,7 @@ DebugLevel defaultLevel = DebugLevel::normal;
         dmpHex(*things); \
     }
 	VECTOR_STRUCTS
+	SCALAR_VECTOR_STRUCTS
 	VECTOR_PTRS
 #undef OP_X
 #define OP_X(Thing) \
@@ -111,8 +113,51 @@ DebugLevel defaultLevel = DebugLevel::normal;
     VECTOR_STRUCTS
     OP_STRUCTS
 #undef OP_X
+#define OP_X(Thing) \
+    void dmp(const Thing& thing) { \
+        OpDebugFormat(thing.debugDump(defaultLevel, defaultBase)); \
+    } \
+    void dmp(const Thing* thing) { \
+        dmp(*thing); \
+    } \
+	void dmpBrief(const Thing& thing) { \
+		OpDebugFormat(thing.debugDump(DebugLevel::brief, defaultBase)); \
+    } \
+    void dmpBrief(const Thing* thing) { \
+        dmpBrief(*thing); \
+    } \
+	void dmpDetailed(const Thing& thing) { \
+		OpDebugFormat(thing.debugDump(DebugLevel::detailed, defaultBase)); \
+    } \
+    void dmpDetailed(const Thing* thing) { \
+        dmpDetailed(*thing); \
+    } \
+    void dmpHex(const Thing& thing) { \
+        OpDebugFormat(thing.debugDump(defaultLevel, DebugBase::hex)); \
+    } \
+    void dmpHex(const Thing* thing) { \
+        dmpHex(*thing); \
+    } \
+    template <typename T> void Thing##Of<T>::dump(DebugLevel dl, DebugBase db) const { \
+        OpDebugFormat(this->debugDump(dl, db)); \
+    } \
+    template <typename T> void Thing##Of<T>::dump() const { \
+        dmp(*this); \
+    } \
+    template <typename T> void Thing##Of<T>::dumpBrief() const { \
+        dmpBrief(*this); \
+    } \
+    template <typename T> void Thing##Of<T>::dumpDetailed() const { \
+        dmpDetailed(*this); \
+    } \
+    template <typename T> void Thing##Of<T>::dumpHex() const { \
+        dmpHex(*this); \
+    }
+    SCALAR_VECTOR_STRUCTS
+    SCALAR_STRUCTS
+#undef OP_X
 #define OP_X(Thing, Struct) \
-    void dmp##Thing(const struct Op##Struct* opStruct) { \
+    void dmp##Thing(const Op##Struct* opStruct) { \
         dmp##Thing(*opStruct); \
     }
 DETAIL_POINTS
@@ -457,7 +502,7 @@ void dmpFile() {
 
 OpContours* fromFileContours = nullptr;
 
-void fromFile(std::vector<PathOpsV0Lib::CurveCallBacks>* callBacks) {
+void fromFile(OpArray<PathOpsV0Lib::CurveCallBacks>* callBacks) {
     std::string buffer;
     if (FILE* file = fopen("dmp.txt", "r")) {
         int seek = fseek(file, 0, SEEK_END);
@@ -789,8 +834,21 @@ std::string OpContours::debugDump(DebugLevel l, DebugBase b) const {
         s += "callerStorage:\n";
         s += callerStorage->debugDump(l, b) + "\n";
     }
-    if (contourStorage)
-        s += contourStorage->debugDump(l, b) + "\n";
+    if (contourCount) {
+        s += "contourStorage:" + STR((size_t) contourCount) + "\n";
+        if (DebugLevel::brief == l) {
+            s += "[";
+            for (auto contour : contours)
+                s += STR(contour->id) + " ";
+            s.pop_back();
+            s += "]";
+        } else {
+            for (auto contour : contours)
+                s += contour->debugDump(l, b) + "\n";
+            s.pop_back();
+        }
+        s += "\n";
+    }
     if (ccStorage)
         s += ccStorage->debugDump("ccStorage", l, b) + "\n";
     // skip contour iterator for now
@@ -847,9 +905,9 @@ void OpContours::dumpSet(const char*& str) {
     if (OpDebugOptional(str, "aliases"))
         OP_ASSERT(0);  // !!! incomplete
     if (OpDebugOptional(str, "curveDataStorage"))
-        CurveDataStorage::DumpSet(str, &curveDataStorage);
+        CurveDataStorage::DumpSet(str, &curveDataStorage, arena);
     if (OpDebugOptional(str, "callerStorage"))
-        CallerDataStorage::DumpSet(str, &callerStorage);
+        CallerDataStorage::DumpSet(str, &callerStorage, arena);
     if (OpDebugOptional(str, "contourStorage"))
         OpContourStorage::DumpSet(str, this);
     if (OpDebugOptional(str, "ccStorage"))
@@ -908,7 +966,8 @@ void OpContours::dumpSet(const char*& str) {
 
 void OpContours::dumpResolveAll(OpContours* self) {
     OP_ASSERT(this == self);
-    contourStorage->dumpResolveAll(self);
+    for (auto contour : contours)
+        contour->dumpResolveAll(self);
     ccStorage->dumpResolveAll(self);
     fillerStorage->dumpResolveAll(self);
     sectStorage->dumpResolveAll(self);
@@ -1253,64 +1312,6 @@ void dmp(std::vector<OpContour>& contours) {
         c.dump();
 }
 
-size_t OpContourStorage::debugCount() const {
-    if (!this)
-        return 0;
-    size_t result = used;
-    OpContourStorage* block = next;
-    while (next) {
-        result += block->used;
-        block = block->next;
-    }
-    return result;
-}
-
-OpContour* OpContourStorage::debugFind(int ID) const {
-	for (int index = 0; index < used; index++) {
-		const OpContour& test = storage[index];
-        if (test.id == ID)
-            return const_cast<OpContour*>(&test);
-	}
-    if (!next)
-        return nullptr;
-    return next->debugFind(ID);
-}
-
-OpContour* OpContourStorage::debugIndex(int index) const {
-    if (!this)
-        return nullptr;
-    const OpContourStorage* block = this;
-    while (index > block->used) {
-        index -= block->used;
-        block = block->next;
-        if (!block)
-            return nullptr;
-    }
-    if (block->used <= index)
-        return nullptr;
-    return const_cast<OpContour*>(&block->storage[index]);
-}
-
-std::string OpContourStorage::debugDump(DebugLevel l, DebugBase b) const {
-    std::string s;
-    size_t count = debugCount();
-    if (!count)
-        return s;
-    s += "contourStorage:" + STR(count) + "\n";
-    if (DebugLevel::brief == l) {
-        s += "[";
-        for (size_t index = 0; index < count; ++index)
-            s += STR(debugIndex(index)->id) + " ";
-        s.pop_back();
-        s += "]";
-    } else {
-        for (size_t index = 0; index < count; ++index)
-            s += debugIndex(index)->debugDump(l, b) + "\n";
-        s.pop_back();
-    }
-    return s;
-}
-
 void OpContourStorage::DumpSet(const char*& str, OpContours* dumpContours) {
     size_t count = OpDebugReadSizeT(str);
     for (size_t index = 0; index < count; ++index) {
@@ -1320,13 +1321,6 @@ void OpContourStorage::DumpSet(const char*& str, OpContours* dumpContours) {
     }
 }
 
-void OpContourStorage::dumpResolveAll(OpContours* c) {
-    size_t count = debugCount();
-    for (size_t index = 0; index < count; ++index) {
-        debugIndex(index)->dumpResolveAll(c);
-    }
-}
-
 ENUM_NAME_STRUCT(OpType);
 #define TYPE_NAME(r) { OpType::r, #r }
 
@@ -1439,8 +1433,9 @@ PathOpsV0Lib::CurveData* CurveDataStorage::dumpSet(const char*& str) {
 }
 
 // sets caller data in contours from string encoded bytes
-void CurveDataStorage::DumpSet(const char*& str, CurveDataStorage** previousPtr) {
-    CurveDataStorage* storage = new CurveDataStorage;
+void CurveDataStorage::DumpSet(const char*& str, CurveDataStorage** previousPtr, 
+        OpArena& arena) {
+    CurveDataStorage* storage = arena.make<CurveDataStorage>(OpMemory::curveData);
     *previousPtr = storage;
     OpDebugRequired(str, "next");
     storage->next = (CurveDataStorage*) OpDebugReadSizeT(str);  // non-zero means there is more
@@ -1450,7 +1445,7 @@ void CurveDataStorage::DumpSet(const char*& str, CurveDataStorage** previousPtr)
     OP_ASSERT(storage->used == bytes.size());
     std::memcpy(storage->storage, &bytes.front(), storage->used);
     if (storage->next)
-        DumpSet(str, &storage->next);
+        DumpSet(str, &storage->next, arena);
 }
 
 std::string OpCurve::debugDump(DebugLevel l, DebugBase b) const {
@@ -1922,7 +1917,7 @@ void dmpT(int ID, float t) {
 }
 
 void dmpT(const OpEdge* e, float t) {
-    OpPoint pt = e->curve.ptAtT((t - e->start.t) / (e->end.t - e->start.t));
+    OpPoint pt = e->curve().ptAtT((t - e->start.t) / (e->end.t - e->start.t));
     OpDebugOut(e->debugDump(defaultLevel, defaultBase) + " t:" + STR(t) + " pt:" 
             + pt.debugDump(defaultLevel, defaultBase) + "\n");
 }
@@ -2043,7 +2038,7 @@ std::string OpEdge::debugDump(DebugLevel l, DebugBase b) const {
     if (dumpIt(EdgeFilter::start)) s += strPtT(EdgeFilter::start, "start", start, " ");
     if (dumpIt(EdgeFilter::end)) s += strPtT(EdgeFilter::end, "end", end, " ");
     if (dumpIt(EdgeFilter::center)) s += strPtT(EdgeFilter::center, "center", center, " ");
-    if (dumpIt(EdgeFilter::curve)) s += strCurve("curve", curve);
+    if (dumpIt(EdgeFilter::curve)) s += strCurve("curve", curve());
     if (upright_impl.pts[0].isFinite() || upright_impl.pts[1].isFinite()) {
         if (dumpIt(EdgeFilter::upright_impl))
             s += strPts("upright_impl", upright_impl);
@@ -2205,8 +2200,9 @@ void OpEdge::dumpSet(const char*& str) {
     if (OpDebugOptional(str, "center"))
         center.dumpSet(str);
     OpDebugRequired(str, "curve");
-    curve.contours = dumpContours;
-    curve.dumpSet(str);
+    curve_impl.contours = dumpContours;
+    curve_impl.dumpSet(str);
+    curveSet = true;
     if (OpDebugOptional(str, "upright_impl")) {
         upright_impl.dumpSet(str);
         OpDebugRequired(str, "vertical_impl");
@@ -2422,7 +2418,7 @@ std::string OpEdge::debugDumpPoints() const {
     std::string s = "[" + STR(id) + "]";
     s += " start:" + start.debugDump(defaultLevel, defaultBase);
     s += " end:" + end.debugDump(defaultLevel, defaultBase);
-    s += " curve:" + curve.debugDump(defaultLevel, defaultBase);
+    s += " curve:" + curve().debugDump(defaultLevel, defaultBase);
     s += " which:" + edgeMatchName(which());
     const OpEdge* startE = debugAdvanceToEnd(EdgeMatch::start);
     if (startE != this)
@@ -2627,8 +2623,9 @@ std::string CallerDataStorage::debugDump(DebugLevel l, DebugBase b) const {
     return s;
 }
 
-void CallerDataStorage::DumpSet(const char*& str, CallerDataStorage** previousPtr) {
-    CallerDataStorage* storage = new CallerDataStorage;
+void CallerDataStorage::DumpSet(const char*& str, CallerDataStorage** previousPtr, 
+        OpArena& arena) {
+    CallerDataStorage* storage = arena.make<CallerDataStorage>(OpMemory::callerData);
     *previousPtr = storage;
     OpDebugRequired(str, "next");
     storage->next = (CallerDataStorage*) OpDebugReadSizeT(str);  // non-zero means there is more
@@ -2638,7 +2635,7 @@ void CallerDataStorage::DumpSet(const char*& str, CallerDataStorage** previousPt
     OP_ASSERT(storage->used == bytes.size());
     std::memcpy(storage->storage, &bytes.front(), storage->used);
     if (storage->next)
-        DumpSet(str, &storage->next);
+        DumpSet(str, &storage->next, arena);
 }
 
 size_t OpEdgeStorage::debugCount() const {
@@ -2819,7 +2816,7 @@ ENUM_NAME(LinkPass, linkPass)
 std::string OpJoiner::debugDump(DebugLevel l, DebugBase b) const {
     std::string s;
     if (DebugLevel::file == l) {
-        auto dumpEdgeIDs = [&s](const std::vector<OpEdge*>& edges, std::string name) {
+        auto dumpEdgeIDs = [&s](const OpArray<OpEdge*>& edges, std::string name) {
             if (!edges.size())
                 return;
             s += name + ":" + STR(edges.size()) + " [";
@@ -2838,7 +2835,7 @@ std::string OpJoiner::debugDump(DebugLevel l, DebugBase b) const {
         if (!path.debugIsEmpty())
             s += "path:" + path.debugDump(l, b) + "\n";
 #endif
-        auto dumpEdges = [&s, l, b](const std::vector<OpEdge*>& edges, std::string name) {
+        auto dumpEdges = [&s, l, b](const OpArray<OpEdge*>& edges, std::string name) {
             size_t activeCount = 0;
             for (auto e : edges)
                 activeCount += e->isActive();
@@ -2910,7 +2907,7 @@ std::string OpJoiner::debugDump(DebugLevel l, DebugBase b) const {
 }
 
 void OpJoiner::dumpSet(const char*& str) {
-    auto setEdgeIDs = [&str](std::vector<OpEdge*>& edges, const char* name) {
+    auto setEdgeIDs = [&str](OpArray<OpEdge*>& edges, const char* name) {
         if (!OpDebugOptional(str, name)) 
             return;
         size_t count = OpDebugReadSizeT(str);
@@ -2949,7 +2946,7 @@ void OpJoiner::dumpSet(const char*& str) {
 }
 
 void OpJoiner::dumpResolveAll(OpContours* c) {
-    auto resolveEdgeIDs = [c](std::vector<OpEdge*>& edges) {
+    auto resolveEdgeIDs = [c](OpArray<OpEdge*>& edges) {
         for (OpEdge*& e : edges)
             c->dumpResolve(e);
     };
@@ -3884,6 +3881,9 @@ void OpSegment::dumpSet(const char*& str) {
     ptBounds.dumpSet(str);
     OpDebugRequired(str, "closeBounds");
     closeBounds.dumpSet(str);
+    ptCount = c.pointCount();
+    isLine = c.isLine();
+    setCurveProperties();
     if (OpDebugOptional(str, "sects:")) {
         int sectCount = OpDebugReadSizeT(str);
         sects.i.resize(sectCount);
@@ -4237,13 +4237,15 @@ std::string OpHulls::debugDump(DebugLevel l, DebugBase b) const {
     return s;
 }
 
-std::string OpVector::debugDump(DebugLevel l, DebugBase b) const {
+template <typename T>
+std::string OpVectorOf<T>::debugDump(DebugLevel l, DebugBase b) const {
     if (DebugLevel::error != l && !isFinite())
         return "";
     return "{" + debugFloat(b, dx) + ", " + debugFloat(b, dy) + "}";
 }
 
-void OpVector::dumpSet(const char*& str) {
+template <typename T>
+void OpVectorOf<T>::dumpSet(const char*& str) {
     OpDebugRequired(str, "{");
     dx = OpDebugHexToFloat(str);
     OpDebugRequired(str, ", ");
@@ -4252,13 +4254,15 @@ void OpVector::dumpSet(const char*& str) {
     OpDebugOptional(str, ",");
 }
 
-std::string OpPoint::debugDump(DebugLevel l, DebugBase b) const {
+template <typename T>
+std::string OpPointOf<T>::debugDump(DebugLevel l, DebugBase b) const {
     if (DebugLevel::error != l && !isFinite())
         return "";
     return "{" + debugFloat(b, x) + ", " + debugFloat(b, y) + "}";
 }
 
-void OpPoint::dumpSet(const char*& str) {
+template <typename T>
+void OpPointOf<T>::dumpSet(const char*& str) {
     OpDebugRequired(str, "{");
     x = OpDebugHexToFloat(str);
     y = OpDebugHexToFloat(str);
@@ -4274,14 +4278,16 @@ void OpPointBounds::dumpSet(const char*& str) {
     OpRect::dumpSet(str);
 }
 
-std::string OpPtT::debugDump(DebugLevel l, DebugBase b) const {
+template <typename T>
+std::string OpPtTOf<T>::debugDump(DebugLevel l, DebugBase b) const {
     if (DebugLevel::error != l && !pt.isFinite() && !OpMath::IsFinite(t))
         return "";
     return pt.debugDump(DebugLevel::error, b) 
             + debugValue(DebugLevel::error, b, "t", t);
 }
 
-void OpPtT::dumpSet(const char*& str) {
+template <typename T>
+void OpPtTOf<T>::dumpSet(const char*& str) {
     pt.dumpSet(str);
     t = OpDebugReadNamedFloat(str, "t");
 }
@@ -4298,12 +4304,14 @@ std::string OpRootPts::debugDump(DebugLevel l, DebugBase b) const {
     return s;
 }
 
-std::string OpRect::debugDump(DebugLevel l, DebugBase b) const {
+template <typename T>
+std::string OpRectOf<T>::debugDump(DebugLevel l, DebugBase b) const {
     return "{" + debugFloat(b, left) + ", " + debugFloat(b, top) + ", "
         + debugFloat(b, right) + ", " + debugFloat(b, bottom) + "}";
 }
 
-void OpRect::dumpSet(const char*& str) {
+template <typename T>
+void OpRectOf<T>::dumpSet(const char*& str) {
     OpDebugRequired(str, "{");
     left = OpDebugHexToFloat(str);
     top = OpDebugHexToFloat(str);
@@ -4312,6 +4320,12 @@ void OpRect::dumpSet(const char*& str) {
     OpDebugRequired(str, "}");
 }
 
+// instantiate the dumps of the geometry used by the engine
+template struct OpPointOf<float>;
+template struct OpPtTOf<float>;
+template struct OpRectOf<float>;
+template struct OpVectorOf<float>;
+
 std::string MatchReverse::debugDump(DebugLevel l, DebugBase b) const {
     std::string s;
     s += "match:" + matchEndsName(match) + " ";
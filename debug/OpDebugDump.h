@@ -42,9 +42,17 @@ OP_X(HullSect) \
 OP_X(OpContour) \
 OP_X(OpEdge) \
 OP_X(OpIntersection) \
-OP_X(OpPtT) \
 OP_X(OpSegment)
 
+// geometry is templated on its scalar; it is forward declared as a template, not as a struct
+#define SCALAR_VECTOR_STRUCTS \
+OP_X(OpPtT)
+
+#define SCALAR_STRUCTS \
+OP_X(OpPoint) \
+OP_X(OpRect) \
+OP_X(OpVector)
+
 #define OP_STRUCTS \
 OP_X(CcCurves) \
 OP_X(LinePts) \
@@ -57,14 +65,11 @@ OP_X(OpHulls) \
 OP_X(OpIntersections) \
 OP_X(OpJoiner) \
 OP_X(OpLimb) \
-OP_X(OpPoint) \
 OP_X(OpPointBounds) \
-OP_X(OpRect) \
 OP_X(OpRootPts) \
 OP_X(OpRoots) \
 OP_X(OpSegments) \
 OP_X(OpTree) \
-OP_X(OpVector) \
 OP_X(OpWinder) \
 OP_X(OpWinding) \
 OP_X(SectRay)
@@ -77,6 +82,13 @@ OP_X(SectRay)
 	VECTOR_STRUCTS
 #undef OP_X
 
+#define OP_X(Thing) \
+	template <typename T> struct Thing##Of; \
+	typedef Thing##Of<float> Thing;
+	SCALAR_VECTOR_STRUCTS
+	SCALAR_STRUCTS
+#undef OP_X
+
 #define VECTOR_PTRS \
 OP_X(OpEdge*) \
 OP_X(const OpEdge*) \
@@ -90,6 +102,7 @@ OP_X(OpSegment*)
 	extern void dmpHex(const std::vector<Thing>* ); \
 	extern void dmpHex(const std::vector<Thing>& );
 	VECTOR_STRUCTS
+	SCALAR_VECTOR_STRUCTS
 	VECTOR_PTRS
 #undef OP_X
 
@@ -101,11 +114,24 @@ OP_X(OpSegment*)
 	OP_STRUCTS
 #undef OP_X
 
+#define OP_X(Thing) \
+	extern void dmp(const Thing* ); \
+	extern void dmp(const Thing& ); \
+	extern void dmpHex(const Thing* );
+	SCALAR_VECTOR_STRUCTS
+	SCALAR_STRUCTS
+#undef OP_X
+
 #define OP_X(Thing) \
 	extern void dmpHex(const struct Thing& );
 	VECTOR_STRUCTS
 #undef OP_X
 
+#define OP_X(Thing) \
+	extern void dmpHex(const Thing& );
+	SCALAR_VECTOR_STRUCTS
+#undef OP_X
+
 #define DUMP_GROUP \
 OP_X(Active) \
 OP_X(Contours) \
@@ -226,7 +252,10 @@ namespace PathOpsV0Lib {
 struct CurveCallBacks;
 }
 
-extern void fromFile(std::vector<PathOpsV0Lib::CurveCallBacks>* callBacks);
+template<typename T> struct OpAllocator;
+
+extern void fromFile(std::vector<PathOpsV0Lib::CurveCallBacks, 
+        OpAllocator<PathOpsV0Lib::CurveCallBacks>>* callBacks);
 extern void verifyFile();
 
 #if OP_DEBUG_VERBOSE
@@ -175,7 +175,7 @@ struct OpDebugEdgeIter {
 		OpCurveCurve* cc = debugGlobalContours->debugCurveCurve;
 		if (cc) {
 			const OpEdge* ccEdge = nullptr;
-			auto checkEdges = [&ccEdge, this, &index](std::vector<OpEdge*> edges) {
+			auto checkEdges = [&ccEdge, this, &index](OpArray<OpEdge*> edges) {
 				if (ccEdge)
 					return;
 				if (edgeIndex - index < edges.size())
@@ -1334,8 +1334,8 @@ void OpDebugImage::drawPoints() {
 			}
 #endif
 			if (drawControlsOn) {
-				for (int index = 1; index < edge->curve.pointCount() - 1; ++index)
-					DebugOpBuild(edge->curve.hullPt(index));
+				for (int index = 1; index < edge->curve().pointCount() - 1; ++index)
+					DebugOpBuild(edge->curve().hullPt(index));
 			}
 			if (drawCentersOn)
 				DebugOpBuild(edge->center.pt, edge->center.t, DebugSprite::square);
@@ -2155,7 +2155,7 @@ OpPoint OpDebugImage::find(int id, float t) {
 			continue;
 		edge->debugDraw = true;
 		DRAW_IDS_ON(Edges);
-		return edge->curve.ptAtT(t);
+		return edge->curve().ptAtT(t);
 	}
 	const OpSegment* segment = nullptr;
 	for (auto s : segmentIterator) {
@@ -2236,7 +2236,7 @@ void drawT(const OpSegment* segment, const OpPtT* ptT) {
 }
 
 void drawT(const OpEdge& edge, float t) {
-	draw(edge.curve.ptAtT(t));
+	draw(edge.curve().ptAtT(t));
 }
 
 void drawT(const OpEdge& edge, const OpPtT& ptT) {
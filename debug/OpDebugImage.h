@@ -21,12 +21,16 @@ struct OpInPath;
 struct OpIntersection;
 struct OpLine;
 struct OpOutPath;
-struct OpPoint;
+template <typename T> struct OpPointOf;
+typedef OpPointOf<float> OpPoint;
 struct OpPointBounds;
-struct OpPtT;
-struct OpRect;
+template <typename T> struct OpPtTOf;
+typedef OpPtTOf<float> OpPtT;
+template <typename T> struct OpRectOf;
+typedef OpRectOf<float> OpRect;
 struct OpSegment;
-struct OpVector;
+template <typename T> struct OpVectorOf;
+typedef OpVectorOf<float> OpVector;
 struct SkRect;
 enum class Axis : int8_t;
 
@@ -11,7 +11,7 @@
 
 struct DebugEdge {
 	DebugEdge(const OpEdge& e) {
-		curve = e.curve;
+		curve = e.curve();
 		segmentCurve = e.segment->c;
 		start = e.start.t;
 		end = e.end.t;
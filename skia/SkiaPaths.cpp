@@ -151,6 +151,14 @@ void SetSkiaCurveCallBacks(Context* context) {
             OP_DEBUG_DUMP_PARAMS(noDumpCurveExtra)
             OP_DEBUG_IMAGE_PARAMS(debugCubicAddToSkPath)
     );
+    SetCurveArea(context, skiaLineType, lineArea);
+    SetCurveArea(context, skiaQuadType, quadArea);
+    SetCurveArea(context, skiaConicType, conicArea);
+    SetCurveArea(context, skiaCubicType, cubicArea);
+    SetPtAtTBatch(context, skiaLineType, linePtAtTBatch);
+    SetPtAtTBatch(context, skiaQuadType, quadPtAtTBatch);
+    SetPtAtTBatch(context, skiaConicType, conicPtAtTBatch);
+    SetPtAtTBatch(context, skiaCubicType, cubicPtAtTBatch);
 }
 
 #if OP_DEBUG_DUMP && !OP_TINY_SKIA
@@ -0,0 +1,148 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#include "OpArena.h"
+
+thread_local OpArena* OpArena::Current = nullptr;
+
+OpArena::OpArena()
+	: callBacks(nullptr)
+	, chunks(nullptr)
+	, reserved(0)
+	, allocations(0)
+	, maxBytes(0)
+	, overflow(0)
+	, refused(false) {
+	for (void*& block : freeBlocks)
+		block = nullptr;
+	for (size_t& bytes : used)
+		bytes = 0;
+}
+
+OpArena::~OpArena() {
+	while (chunks) {
+		Chunk* next = chunks->next;
+		Return(chunks);
+		chunks = next;
+	}
+}
+
+void* OpArena::allocate(size_t size, OpMemory m) {
+	used[(int) m] += size;
+	size_t sizeClass = SizeClass(size);
+	if (sizeClass < OpArenaClasses && freeBlocks[sizeClass]) {
+		void* result = freeBlocks[sizeClass];
+		freeBlocks[sizeClass] = *(void**) result;
+		return result;
+	}
+	size_t bytes = sizeClass < OpArenaClasses ? (size_t) 1 << (sizeClass + OpArenaMinClass) : size;
+	Chunk* chunk = obtain(bytes);
+	chunk->next = chunks;
+	chunks = chunk;
+	return chunk + 1;
+}
+
+void* OpArena::AllocateContainer(size_t size) {
+	OpArena* arena = Current;
+	Chunk* chunk;
+	if (arena) {
+		chunk = arena->obtain(size);
+		arena->used[(int) OpMemory::containers] += size;
+		++arena->allocations;
+	} else {
+		chunk = (Chunk*) ::operator new(sizeof(Chunk) + size);
+		chunk->arena = nullptr;
+		chunk->freeFunc = nullptr;
+		chunk->user = nullptr;
+	}
+	return chunk + 1;
+}
+
+void OpArena::FreeContainer(void* block, size_t size) {
+	Chunk* chunk = (Chunk*) block - 1;
+	if (OpArena* arena = chunk->arena) {
+		OP_ASSERT(arena->used[(int) OpMemory::containers] >= size);
+		arena->used[(int) OpMemory::containers] -= size;
+		arena->reserved -= sizeof(Chunk) + size;
+	}
+	Return(chunk);
+}
+
+// grows the block with the reallocate memory callback if the block came from the callbacks
+// now in effect and stays within max bytes; otherwise allocates, copies and frees
+void* OpArena::ReallocateContainer(void* block, size_t size, size_t grown) {
+	Chunk* chunk = (Chunk*) block - 1;
+	OpArena* arena = chunk->arena;
+	const PathOpsV0Lib::ContextCallBacks* hooks = arena ? arena->callBacks : nullptr;
+	if (hooks && hooks->reallocateMemory && chunk->freeFunc
+			&& chunk->freeFunc == hooks->freeMemory && chunk->user == hooks->memoryUser
+			&& (!arena->maxBytes || arena->reserved + grown - size <= arena->maxBytes)) {
+		Chunk* moved = (Chunk*) (*hooks->reallocateMemory)(hooks->memoryUser, chunk, 
+				sizeof(Chunk) + grown);
+		if (moved) {
+			arena->used[(int) OpMemory::containers] += grown - size;
+			arena->reserved += grown - size;
+			return moved + 1;
+		}
+	}
+	void* bigger = AllocateContainer(grown);
+	std::memcpy(bigger, block, size);
+	FreeContainer(block, size);
+	return bigger;
+}
+
+PathOpsV0Lib::ContextMemory OpArena::memory() const {
+	return { used[(int) OpMemory::contours], used[(int) OpMemory::curveData],
+			used[(int) OpMemory::edges], used[(int) OpMemory::intersections],
+			used[(int) OpMemory::limbs], used[(int) OpMemory::callerData],
+			used[(int) OpMemory::containers], used[(int) OpMemory::resolve], reserved, 
+			allocations, overflow };
+}
+
+// The free hook is saved with the block, so that hooks may be set after blocks are allocated.
+// A block that would pass max bytes is refused here, without asking the callback, so that the
+// op stops at the end of the current unit of work.
+OpArena::Chunk* OpArena::obtain(size_t bytes) {
+	PathOpsV0Lib::AllocateMemory allocateFunc = callBacks ? callBacks->allocateMemory : nullptr;
+	bool overLimit = maxBytes && reserved + sizeof(Chunk) + bytes > maxBytes;
+	Chunk* chunk = allocateFunc && !overLimit ?
+			(Chunk*) (*allocateFunc)(callBacks->memoryUser, sizeof(Chunk) + bytes) : nullptr;
+	if (chunk) {
+		chunk->freeFunc = callBacks->freeMemory;
+		chunk->user = callBacks->memoryUser;
+	} else {
+		bool refusal = overLimit || nullptr != allocateFunc;
+		refused |= refusal;
+		chunk = (Chunk*) ::operator new(sizeof(Chunk) + bytes);
+		chunk->freeFunc = nullptr;
+		chunk->user = nullptr;
+		if (refusal)
+			overflow += sizeof(Chunk) + bytes;
+	}
+	chunk->arena = this;
+	reserved += sizeof(Chunk) + bytes;
+	return chunk;
+}
+
+void OpArena::release(void* block, size_t size, OpMemory m) {
+	OP_ASSERT(used[(int) m] >= size);
+	used[(int) m] -= size;
+	size_t sizeClass = SizeClass(size);
+	if (sizeClass >= OpArenaClasses)
+		return;  // freed with the arena
+	*(void**) block = freeBlocks[sizeClass];
+	freeBlocks[sizeClass] = block;
+}
+
+void OpArena::Return(Chunk* chunk) {
+	if (chunk->freeFunc)
+		(*chunk->freeFunc)(chunk->user, chunk);
+	else
+		::operator delete(chunk);
+}
+
+// returns index of smallest power of two class that holds size; OpArenaClasses if too large
+size_t OpArena::SizeClass(size_t size) {
+	size_t sizeClass = 0;
+	while (sizeClass < OpArenaClasses && ((size_t) 1 << (sizeClass + OpArenaMinClass)) < size)
+		++sizeClass;
+	return sizeClass;
+}
@@ -0,0 +1,289 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef OpArena_DEFINED
+#define OpArena_DEFINED
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "PathOpsTypes.h"
+
+// what a block holds; bytes are accounted separately for each
+enum class OpMemory {
+	contours,
+	curveData,      // points and weights of segment and edge curves
+	edges,          // curve-curve and filler edges
+	intersections,
+	limbs,          // joiner search tree
+	callerData,     // context, contour and winding data copied from the caller
+	containers,     // std::vector storage allocated through OpAllocator
+	resolve,        // state kept between resolve steps, and the contains index
+	count
+};
+
+constexpr size_t OpArenaMinClass = 8;   // smallest block is 256 bytes
+constexpr size_t OpArenaClasses = 13;   // largest pooled block is 1 MB
+
+// Supplies the storage blocks of one context. Each block is rounded up to a power of two size
+// class; blocks released while the context runs are kept on their size class's free list and
+// handed out again, so nothing is returned to the system until the context is deleted. Blocks
+// larger than the largest class are allocated singly and are not reused.
+// Memory comes from the context's allocate memory callback if set, or the global heap if not.
+// If the callback refuses a block, or the block would pass max bytes, the block comes from the
+// global heap instead, so that the work in progress can finish; the refusal is kept until the
+// context reports it as an error, and the block's bytes are added to overflow.
+// Container storage is allocated and freed as containers grow and shrink; it uses the arena
+// current to the thread when the container grows.
+struct OpArena {
+	// precedes each block obtained from the system; keeps the block maximally aligned
+	struct alignas(std::max_align_t) Chunk {
+		Chunk* next;  // next storage block; unused by container blocks
+		OpArena* arena;  // arena that allocated container block; null if none was current
+		PathOpsV0Lib::FreeMemory freeFunc;  // hook in effect when allocated; null for heap
+		void* user;
+	};
+
+	OpArena();
+	~OpArena();
+	void* allocate(size_t size, OpMemory );
+	static void* AllocateContainer(size_t size);
+	static void FreeContainer(void* block, size_t size);
+	static void* ReallocateContainer(void* block, size_t size, size_t grown);
+	PathOpsV0Lib::ContextMemory memory() const;
+	Chunk* obtain(size_t bytes);
+	void release(void* block, size_t size, OpMemory );
+	static void Return(Chunk* );
+	static size_t SizeClass(size_t size);
+
+	template<typename T, typename... Args> T* make(OpMemory m, Args&&... args) {
+		return new (allocate(sizeof(T), m)) T(std::forward<Args>(args)...);
+	}
+
+	template<typename T> void destroy(T* block, OpMemory m) {
+		block->~T();
+		release(block, sizeof(T), m);
+	}
+
+	static thread_local OpArena* Current;  // arena of the context being called, if any
+	const PathOpsV0Lib::ContextCallBacks* callBacks;  // set by the owning context
+	Chunk* chunks;  // every storage block obtained from the system
+	void* freeBlocks[OpArenaClasses];  // released blocks, linked through their first word
+	size_t used[(int) OpMemory::count];  // bytes in blocks not yet released
+	size_t reserved;  // bytes obtained from the system and not yet returned
+	size_t allocations;  // container blocks obtained, including those since returned
+	size_t maxBytes;  // reserved past which blocks are refused; zero if unlimited
+	size_t overflow;  // bytes taken from the heap after a refusal, including those since returned
+	bool refused;  // block refused by allocate memory or max bytes; cleared when reported
+};
+
+// makes an arena current while a context is called
+struct OpArenaScope {
+	OpArenaScope(OpArena& arena)
+		: saved(OpArena::Current) {
+		OpArena::Current = &arena;
+	}
+	~OpArenaScope() {
+		OpArena::Current = saved;
+	}
+
+	OpArena* saved;
+};
+
+// routes std::vector storage through the current context's arena; stateless, so containers
+// may be moved, swapped and freed without a current arena
+template<typename T>
+struct OpAllocator {
+	typedef T value_type;
+
+	OpAllocator() = default;
+
+	template<typename U> OpAllocator(const OpAllocator<U>& ) {
+	}
+
+	T* allocate(size_t count) {
+		return (T*) OpArena::AllocateContainer(count * sizeof(T));
+	}
+
+	void deallocate(T* block, size_t count) {
+		OpArena::FreeContainer(block, count * sizeof(T));
+	}
+
+	template<typename U> bool operator==(const OpAllocator<U>& ) const {
+		return true;
+	}
+
+	template<typename U> bool operator!=(const OpAllocator<U>& ) const {
+		return false;
+	}
+};
+
+template<typename T> using OpArray = std::vector<T, OpAllocator<T>>;
+
+// Holds up to N entries in place, and moves them to container storage from the current arena
+// when more are added. Supports the parts of std::vector the engine uses. Entries are copied
+// with memcpy and are not destroyed, so they must be trivially copyable.
+template<typename T, size_t N>
+struct OpSmallArray {
+	static_assert(std::is_trivially_copyable<T>::value, "entries are copied as bytes");
+	typedef T value_type;
+	typedef T* iterator;
+	typedef const T* const_iterator;
+
+	OpSmallArray()
+		: items((T*) local)
+		, count(0)
+		, capacity(N) {
+	}
+
+	OpSmallArray(const OpSmallArray& a)
+		: OpSmallArray() {
+		append(a.items, a.count);
+	}
+
+	OpSmallArray(OpSmallArray&& a)
+		: OpSmallArray() {
+		take(a);
+	}
+
+	~OpSmallArray() {
+		if (spilled())
+			OpArena::FreeContainer(items, capacity * sizeof(T));
+	}
+
+	OpSmallArray& operator=(const OpSmallArray& a) {
+		if (this != &a) {
+			count = 0;
+			append(a.items, a.count);
+		}
+		return *this;
+	}
+
+	OpSmallArray& operator=(OpSmallArray&& a) {
+		if (this != &a)
+			take(a);
+		return *this;
+	}
+
+	T& operator[](size_t index) {
+		OP_ASSERT(index < count);
+		return items[index]; }
+	const T& operator[](size_t index) const {
+		OP_ASSERT(index < count);
+		return items[index]; }
+	T& back() {
+		OP_ASSERT(count);
+		return items[count - 1]; }
+	const T& back() const {
+		OP_ASSERT(count);
+		return items[count - 1]; }
+	T* begin() {
+		return items; }
+	const T* begin() const {
+		return items; }
+	void clear() {
+		count = 0; }
+	T* data() {
+		return items; }
+	const T* data() const {
+		return items; }
+	bool empty() const {
+		return !count; }
+	T* end() {
+		return items + count; }
+	const T* end() const {
+		return items + count; }
+	T& front() {
+		OP_ASSERT(count);
+		return items[0]; }
+	const T& front() const {
+		OP_ASSERT(count);
+		return items[0]; }
+	size_t size() const {
+		return count; }
+
+	template<typename... Args> void emplace_back(Args&&... args) {
+		T entry(std::forward<Args>(args)...);
+		push_back(entry);
+	}
+
+	T* insert(const T* pos, const T& entry) {
+		size_t index = pos - items;
+		OP_ASSERT(index <= count);
+		T copy = entry;  // entry may be in the array
+		reserve(count + 1);
+		std::memmove(items + index + 1, items + index, (count - index) * sizeof(T));
+		items[index] = copy;
+		++count;
+		return items + index;
+	}
+
+	void push_back(const T& entry) {
+		if (count < capacity) {
+			items[count++] = entry;
+			return;
+		}
+		T copy = entry;
+		reserve(count + 1);
+		items[count++] = copy;
+	}
+
+	void reserve(size_t size) {
+		if (size <= capacity)
+			return;
+		size_t grown = std::max(size, (size_t) capacity * 2);
+		T* bigger;
+		if (spilled())
+			bigger = (T*) OpArena::ReallocateContainer(items, capacity * sizeof(T), 
+					grown * sizeof(T));
+		else {
+			bigger = (T*) OpArena::AllocateContainer(grown * sizeof(T));
+			std::memcpy((void*) bigger, items, count * sizeof(T));
+		}
+		items = bigger;
+		capacity = (uint32_t) grown;
+	}
+
+	void resize(size_t size) {
+		reserve(size);
+		for (size_t index = count; index < size; ++index)
+			new (&items[index]) T();
+		count = (uint32_t) size;
+	}
+
+	bool spilled() const {
+		return items != (const T*) local;
+	}
+
+	void append(const T* entries, size_t entryCount) {
+		reserve(count + entryCount);
+		std::memcpy((void*) (items + count), entries, entryCount * sizeof(T));
+		count += (uint32_t) entryCount;
+	}
+
+	// replaces entries with those of a, and leaves a empty, using its own storage
+	void take(OpSmallArray& a) {
+		if (spilled())
+			OpArena::FreeContainer(items, capacity * sizeof(T));
+		items = (T*) local;
+		count = 0;
+		capacity = N;
+		if (a.spilled()) {
+			items = a.items;
+			capacity = a.capacity;
+			count = a.count;
+			a.items = (T*) a.local;
+			a.capacity = N;
+		} else
+			append(a.items, a.count);
+		a.count = 0;
+	}
+
+	T* items;
+	uint32_t count;
+	uint32_t capacity;
+	alignas(T) char local[N * sizeof(T)];
+};
+
+#endif
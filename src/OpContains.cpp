@@ -0,0 +1,124 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#include "OpContains.h"
+#include "OpContour.h"
+
+OpContains::OpContains(const OpContours& contours) {
+	for (int index = 0; index < (int) contours.outputEdges.size(); ++index) {
+		firstCurves.push_back(curves.size());
+		contours.outputContour(index, curves);
+		curveContours.resize(curves.size(), index);
+		int parent;
+		depths.push_back(contours.nesting(index, parent));
+	}
+	sums.resize(depths.size());
+	OpArray<float> ys;
+	for (const OpCurve& curve : curves) {
+		bounds.push_back(curve.ptBounds());
+		outputBounds.add(bounds.back());
+		ys.push_back(bounds.back().top);
+		ys.push_back(bounds.back().bottom);
+	}
+	std::sort(ys.begin(), ys.end());
+	ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+	// !!! band count is a guess; a few curves per band keeps most queries short
+	size_t bandCount = curves.size() / 4 + 1;
+	size_t step = std::max((size_t) 1, ys.size() / bandCount);
+	for (size_t index = 0; index < ys.size(); index += step)
+		bandTops.push_back(ys[index]);
+	OpArray<OpArray<int>> bands(bandTops.size());
+	for (size_t index = 0; index < curves.size(); ++index) {
+		size_t last = band(bounds[index].bottom);
+		for (size_t b = band(bounds[index].top); b <= last; ++b)
+			bands[b].push_back((int) index);
+	}
+	for (const OpArray<int>& b : bands) {
+		bandStarts.push_back(bandCurves.size());
+		bandCurves.insert(bandCurves.end(), b.begin(), b.end());
+	}
+	bandStarts.push_back(bandCurves.size());
+	// contours whose rays found no nesting are tested against the other contours instead
+	int parent;
+	for (size_t index = 0; index < depths.size(); ++index) {
+		if (depths[index] < 0)
+			depths[index] = enclosing((int) index, parent);
+	}
+}
+
+size_t OpContains::band(float y) const {
+	auto above = std::upper_bound(bandTops.begin(), bandTops.end(), y);
+	return bandTops.begin() == above ? 0 : above - bandTops.begin() - 1;
+}
+
+// A curve end on the ray counts only if the curve extends below the ray from there.
+// Where two curves meet on the ray, this counts one crossing if the contour passes through,
+// and zero or two (with opposite directions) if the contour turns back.
+// Sums crossing directions by contour, lists the contours crossed, and returns the crossings.
+// The caller clears sums and crossed.
+int OpContains::cross(OpPoint pt) const {
+	if (!curves.size() || !outputBounds.contains(pt))
+		return 0;
+	size_t b = band(pt.y);
+	int crossings = 0;
+	for (size_t entry = bandStarts[b]; entry < bandStarts[b + 1]; ++entry) {
+		int index = bandCurves[entry];
+		if (pt.y < bounds[index].top || pt.y > bounds[index].bottom || pt.x < bounds[index].left)
+			continue;
+		const OpCurve& curve = curves[index];
+		OpRoots roots = curve.axisRawHit(Axis::horizontal, pt.y, MatchEnds::none);
+		for (size_t r = 0; r < roots.count; ++r) {
+			float t = OpMath::PinNear(roots.roots[r]);
+			if (!OpMath::Between(0, t, 1))
+				continue;
+			if (pt.y == curve.firstPt().y && t < .5f)
+				t = 0;
+			else if (pt.y == curve.lastPt().y && t > .5f)
+				t = 1;
+			if (curve.ptAtT(t).x >= pt.x)
+				continue;
+			float dy = curve.tangent(t).dy;
+			if (0 == t ? dy <= 0 : 1 == t ? dy >= 0 : !dy)
+				continue;
+			int contour = curveContours[index];
+			if (!sums[contour])
+				crossed.push_back(contour);
+			sums[contour] += dy > 0 ? 1 : -1;
+			++crossings;
+		}
+	}
+	return crossings;
+}
+
+// returns the number of other output contours that enclose a point on this one, and sets the
+// deepest of those, if any
+int OpContains::enclosing(int exclude, int& parent) const {
+	cross(curves[firstCurves[exclude]].ptAtT(.5f));
+	int count = 0;
+	parent = -1;
+	for (int contour : crossed) {
+		if (exclude != contour && (sums[contour] & 1)) {
+			if (!count++ || depths[contour] > depths[parent])
+				parent = contour;
+		}
+		sums[contour] = 0;
+	}
+	crossed.clear();
+	return count;
+}
+
+// Returns zero if outside. If inside, returns the direction of the outermost output contour
+// enclosing the point, so that holes and the contours within them count as turning opposite
+// to the contour enclosing them.
+int OpContains::winding(OpPoint pt) const {
+	int crossings = cross(pt);
+	int winding = 0;
+	int outerDepth = OpMax;
+	for (int contour : crossed) {
+		if ((sums[contour] & 1) && depths[contour] < outerDepth) {  // contour encloses point
+			outerDepth = depths[contour];
+			winding = sums[contour] > 0 ? 1 : -1;
+		}
+		sums[contour] = 0;
+	}
+	crossed.clear();
+	return crossings & 1 ? winding : 0;
+}
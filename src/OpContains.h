@@ -0,0 +1,34 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef OpContains_DEFINED
+#define OpContains_DEFINED
+
+#include "OpCurve.h"
+#include "OpTightBounds.h"
+
+struct OpContours;
+
+// Output curves grouped into horizontal bands sorted by height. A point query finds its band
+// with a binary search, then sums the directions of the band's curves crossed by a ray from
+// the point to the left, by output contour. Output contours may turn either way, so the point
+// is inside if the ray crosses an odd number of curves.
+struct OpContains {
+	OpContains(const OpContours& );
+	size_t band(float y) const;
+	int cross(OpPoint ) const;
+	int enclosing(int contour, int& parent) const;
+	int winding(OpPoint ) const;
+
+	OpArray<OpCurve> curves;  // output curves, in output direction
+	OpArray<int> curveContours;  // output contour of each curve
+	OpArray<size_t> firstCurves;  // index of the first curve of each output contour
+	OpArray<int> depths;  // number of output contours enclosing each output contour
+	mutable OpArray<int> sums;  // crossing directions of each output contour; zero between queries
+	mutable OpArray<int> crossed;  // output contours crossed by the current query
+	OpArray<OpPointBounds> bounds;  // bounds of each curve
+	OpArray<float> bandTops;  // sorted; first band top is output bounds top
+	OpArray<size_t> bandStarts;  // first entry in band curves for each band, plus end
+	OpArray<int> bandCurves;  // index of each curve overlapping each band
+	OpPointBounds outputBounds;
+};
+
+#endif
@@ -1,37 +1,61 @@
 // (c) 2023, Cary Clark cclark2@gmail.com
 #include "OpContour.h"
+#include "OpContains.h"
+#include "OpCoverage.h"
 #include "OpCurveCurve.h"
 #include "OpJoiner.h"
+#include "OpMesh.h"
 #include "OpSegments.h"
 #include "OpWinder.h"
 #include "PathOps.h"
 
-char* CallerDataStorage::Allocate(size_t size, CallerDataStorage** callerStoragePtr) {
-    if (!*callerStoragePtr)
-        *callerStoragePtr = new CallerDataStorage;
+// align is a power of two; it is applied to the address, so it may exceed the block's alignment
+char* CallerDataStorage::Allocate(size_t size, size_t align, CallerDataStorage** callerStoragePtr,
+        OpArena& arena) {
     CallerDataStorage* callerStorage = *callerStoragePtr;
-    if (callerStorage->used + size > sizeof(callerStorage->storage)) {
-        CallerDataStorage* next = new CallerDataStorage;
+    size_t pad = callerStorage ? (size_t) -(intptr_t) &callerStorage->storage[callerStorage->used]
+            & (align - 1) : 0;
+    if (!callerStorage || callerStorage->used + pad + size > sizeof(callerStorage->storage)) {
+        CallerDataStorage* next = arena.make<CallerDataStorage>(OpMemory::callerData);
         next->next = callerStorage;
-        callerStorage = next;
+        *callerStoragePtr = callerStorage = next;
+        pad = (size_t) -(intptr_t) callerStorage->storage & (align - 1);
+        OP_ASSERT(pad + size <= sizeof(callerStorage->storage));
     }
-    char* result = &callerStorage->storage[callerStorage->used];
-    size_t alignSize = alignof(void*);  // !!! allow caller to specify this?
-    size_t alignPart = size % alignSize;
-    if (alignPart)
-        size += alignSize - alignPart;  // round up to next alignment
-    callerStorage->used += size;
+    char* result = &callerStorage->storage[callerStorage->used + pad];
+    callerStorage->used += pad + size;
     return result;
 }
 
 void OpContour::addCallerData(PathOpsV0Lib::AddContour data) {
-    caller.data = CallerDataStorage::Allocate(data.size, &contours->callerStorage);
+    caller.data = CallerDataStorage::Allocate(data.size, contours->callerAlign,
+            &contours->callerStorage, contours->arena);
     std::memcpy(caller.data, data.data, data.size);
     caller.size = data.size;  // !!! don't know if size is really needed ...
 }
 
+// adds lines in place of a curve; returns false if the curve is already a line
+bool OpContour::addFlattened(PathOpsV0Lib::AddCurve curve, PathOpsV0Lib::AddWinding windings) {
+    OpCurve source;  // reads caller's points in place
+    source.c = { (PathOpsV0Lib::CurveData*) curve.points, curve.size, curve.type };
+    source.contours = contours;
+    if (source.isLine())
+        return false;
+    OpArray<OpPoint> points(1, source.firstPt());
+    source.flatten(contours->flattenTolerance, points);
+    for (size_t index = 1; index < points.size(); ++index) {
+        OpPoint line[2] = { contours->snap(points[index - 1]), contours->snap(points[index]) };
+        if (line[0] == line[1])
+            continue;
+        segments.emplace_back(PathOpsV0Lib::AddCurve { line, sizeof(line), 
+                contours->flattenLineType }, windings);
+    }
+    return true;
+}
+
 void OpContours::addCallerData(PathOpsV0Lib::AddContext data) {
-    caller.data = CallerDataStorage::Allocate(data.size, &callerStorage);
+    caller.data = CallerDataStorage::Allocate(data.size, alignof(std::max_align_t), &callerStorage,
+            arena);
     std::memcpy(caller.data, data.data, data.size);
     caller.size = data.size;  // !!! don't know if size is really needed ...
 }
@@ -58,7 +82,7 @@ bool OpContour::addConic(OpPoint pts[3], float weight) {
     OpConic conic(pts, weight);
     if (!bounds.calcBounds(conic))
         return false;
-    std::vector<ExtremaT> extrema = bounds.findExtrema(pts[0], pts[2]);
+    OpArray<ExtremaT> extrema = bounds.findExtrema(pts[0], pts[2]);
     if (!extrema.size()) {
         OpCurve whole(pts, weight, OpType::conic);
         if (whole.isLinear()) {
@@ -100,7 +124,7 @@ bool OpContour::addCubic(OpPoint pts[4]) {
     OpCubic cubic(pts);
     if (!bounds.calcBounds(cubic))
         return false;
-    std::vector<ExtremaT> extrema = bounds.findExtrema(pts[0], pts[3]);
+    OpArray<ExtremaT> extrema = bounds.findExtrema(pts[0], pts[3]);
 
     if (!extrema.size()) {
         OpCurve whole(pts, OpType::cubic);
@@ -220,7 +244,7 @@ bool OpContour::addQuad(OpPoint pts[3]) {
     OpQuad quad(pts);
     if (!bounds.calcBounds(quad))
         return false;
-    std::vector<ExtremaT> extrema = bounds.findExtrema(pts[0], pts[2]);
+    OpArray<ExtremaT> extrema = bounds.findExtrema(pts[0], pts[2]);
     if (!extrema.size()) {
         OpCurve whole(pts, OpType::quad);
         if (whole.isLinear()) {
@@ -258,6 +282,38 @@ int OpContour::nextID() const {
     return ++contours->uniqueID;
 }
 
+#if OP_TEST_NEW_INTERFACE
+// resolve moves segment ends and combines coincident windings; put them back as they were added
+void OpContour::restoreSegments() {
+    const char* data = saved.data();
+    for (size_t index = 0; index < savedCount; ++index) {
+        OpSegment& segment = segments[index];
+        std::memcpy(segment.c.c.data, data, segment.c.c.size);
+        data += segment.c.c.size;
+        std::memcpy(segment.winding.w.data, data, segment.winding.w.size);
+        data += segment.winding.w.size;
+        segment.sects.i.clear();
+        segment.sects.resort = false;
+        segment.edges.clear();
+        segment.boundsIndex = -1;
+        segment.disabled = false;
+        segment.setBounds();
+        segment.setCurveProperties();
+    }
+}
+
+// copies the data of segments added since the last resolve
+void OpContour::saveSegments() {
+    for (; savedCount < segments.size(); ++savedCount) {
+        const OpSegment& segment = segments[savedCount];
+        const char* curveData = (const char*) segment.c.c.data;
+        saved.insert(saved.end(), curveData, curveData + segment.c.c.size);
+        const char* windingData = (const char*) segment.winding.w.data;
+        saved.insert(saved.end(), windingData, windingData + segment.winding.w.size);
+    }
+}
+#endif
+
 // end of contour; start of contours
 
 #if !OP_TEST_NEW_INTERFACE
@@ -272,6 +328,14 @@ static const OpOperator OpInverse[+OpOperator::ReverseSubtract + 1][2][2] {
 };
 #endif
 
+// frees state allocated from the arena, if any
+template<typename T> void FreeState(OpArena& arena, T*& state) {
+    if (!state)
+        return;
+    arena.destroy(state, OpMemory::resolve);
+    state = nullptr;
+}
+
 OpContours::OpContours()
     : 
 #if !OP_TEST_NEW_INTERFACE
@@ -282,18 +346,42 @@ OpContours::OpContours()
 #endif
       ccStorage(nullptr)
     , curveDataStorage(nullptr)
-    , contourStorage(nullptr)
+    , contourCount(0)
     , contours(this)
     , fillerStorage(nullptr)
     , sectStorage(nullptr)
     , limbStorage(nullptr)
     , callerStorage(nullptr)
+    , callerAlign(alignof(void*))
 #if !OP_TEST_NEW_INTERFACE
     , left(OpFillType::unset)
     , right(OpFillType::unset)
 #endif
     , uniqueID(0) 
-    , caller({nullptr, 0}) {
+    , contextCallBacks({nullptr, nullptr, nullptr, nullptr, nullptr, nullptr})
+    , contextFree(nullptr)
+    , contextFreeUser(nullptr)
+    , contourNesting(nullptr)
+    , caller({nullptr, 0})
+    , resolveSegments(nullptr)
+    , resolveWinder(nullptr)
+    , resolveJoiner(nullptr)
+    , resolvePhase(ResolvePhase::start)
+    , stepsToClock(0)
+    , limits({0, 0, 0, 0, 0, 0})
+    , error(PathOpsV0Lib::ContextError::none)
+    , cancel(false)
+    , meshOutput(nullptr)
+    , coverageMask({nullptr, 0, 0, 0, 1, 0, 0, 0, 1, 0})
+    , measureOutput(nullptr)
+    , measureTolerance(0)
+    , flattenLineType(OpType::no)
+    , flattenTolerance(0)
+    , snapGrid(0)
+    , counts({0, 0, 0, 0, 0, 0})
+    , flatTolerance(0)
+    , containsIndex(nullptr) {
+    arena.callBacks = &contextCallBacks;
 #if OP_DEBUG_VALIDATE
     debugValidateEdgeIndex = 0;
     debugValidateJoinerIndex = 0;
@@ -327,30 +415,25 @@ OpContours::OpContours(OpInPath& l, OpInPath& r, OpOperator op)
 }
 
 OpContours::~OpContours() {
+    releaseResolve();
+    FreeState(arena, containsIndex);
     release(ccStorage);
     while (curveDataStorage) {
         CurveDataStorage* next = curveDataStorage->next;
-        delete curveDataStorage;
+        arena.destroy(curveDataStorage, OpMemory::curveData);
         curveDataStorage = next;
     }
-    while (contourStorage) {
-        OpContourStorage* next = contourStorage->next;
-        delete contourStorage;
-        contourStorage = next;
-    }
+    for (OpContourStorage* block : contourStorage)
+        arena.destroy(block, OpMemory::contours);
     release(fillerStorage);
-    while (sectStorage) {
-        OpSectStorage* next = sectStorage->next;
-        delete sectStorage;
-        sectStorage = next;
-    }
+    release(sectStorage);
     if (limbStorage) {
-        limbStorage->reset();
-        delete limbStorage;
+        release(limbStorage->nextBlock);
+        arena.destroy(limbStorage, OpMemory::limbs);
     }
     while (callerStorage) {
         CallerDataStorage* next = callerStorage->next;
-        delete callerStorage;
+        arena.destroy(callerStorage, OpMemory::callerData);
         callerStorage = next;
     }
 #if OP_DEBUG
@@ -376,6 +459,7 @@ void OpContours::addAlias(OpPoint pt, OpPoint alias) {
             return;
     }
     aliases.push_back({pt, alias});
+    ++counts.aliases;
 }
 
 #if !OP_TEST_NEW_INTERFACE
@@ -389,21 +473,18 @@ OpContour* OpContours::addMove(OpContour* last, OpOperand operand , const OpPoin
 #endif
 
 OpContour* OpContours::allocateContour() {
-    if (!contourStorage)
-        contourStorage = new OpContourStorage;
-    if (contourStorage->used == ARRAY_COUNT(contourStorage->storage)) {
-        OpContourStorage* next = new OpContourStorage;
-        next->next = contourStorage;
-        contourStorage = next;
-    }
-    return &contourStorage->storage[contourStorage->used++];
+    if (contourCount == contourStorage.size() * OpContourBlock)
+        contourStorage.push_back(arena.make<OpContourStorage>(OpMemory::contours));
+    OpContourStorage* block = contourStorage.back();
+    ++contourCount;
+    return &block->storage[block->used++];
 }
 
 OpEdge* OpContours::allocateEdge(OpEdgeStorage*& edgeStorage) {
     if (!edgeStorage)
-        edgeStorage = new OpEdgeStorage;
+        edgeStorage = arena.make<OpEdgeStorage>(OpMemory::edges);
     if (edgeStorage->used == ARRAY_COUNT(edgeStorage->storage)) {
-        OpEdgeStorage* next = new OpEdgeStorage;
+        OpEdgeStorage* next = arena.make<OpEdgeStorage>(OpMemory::edges);
         OP_ASSERT(!next->next);
         next->next = edgeStorage;
         edgeStorage = next;
@@ -413,9 +494,9 @@ OpEdge* OpContours::allocateEdge(OpEdgeStorage*& edgeStorage) {
 
 PathOpsV0Lib::CurveData* OpContours::allocateCurveData(size_t size) {
     if (!curveDataStorage)
-        curveDataStorage = new CurveDataStorage;
+        curveDataStorage = arena.make<CurveDataStorage>(OpMemory::curveData);
     if (curveDataStorage->used + size > sizeof(curveDataStorage->storage)) {
-        CurveDataStorage* next = new CurveDataStorage;
+        CurveDataStorage* next = arena.make<CurveDataStorage>(OpMemory::curveData);
         next->next = curveDataStorage;
         curveDataStorage = next;
     }
@@ -424,9 +505,9 @@ PathOpsV0Lib::CurveData* OpContours::allocateCurveData(size_t size) {
 
 OpIntersection* OpContours::allocateIntersection() {
     if (!sectStorage)
-        sectStorage = new OpSectStorage;
+        sectStorage = arena.make<OpSectStorage>(OpMemory::intersections);
     if (sectStorage->used == ARRAY_COUNT(sectStorage->storage)) {
-        OpSectStorage* next = new OpSectStorage;
+        OpSectStorage* next = arena.make<OpSectStorage>(OpMemory::intersections);
         OP_ASSERT(!next->next);
         next->next = sectStorage;
         sectStorage = next;
@@ -437,7 +518,7 @@ OpIntersection* OpContours::allocateIntersection() {
 OpLimb* OpContours::allocateLimb(OpTree* tree) {
     OP_DEBUG_DUMP_CODE(dumpTree = tree);
     if (limbStorage->used == ARRAY_COUNT(limbStorage->storage)) {
-        OpLimbStorage* next = new OpLimbStorage;
+        OpLimbStorage* next = arena.make<OpLimbStorage>(OpMemory::limbs);
         next->nextBlock = limbStorage;
         limbStorage->prevBlock = next;
         limbStorage = next;
@@ -446,7 +527,7 @@ OpLimb* OpContours::allocateLimb(OpTree* tree) {
 }
 
 PathOpsV0Lib::WindingData* OpContours::allocateWinding(size_t size) {
-    void* result = CallerDataStorage::Allocate(size, &callerStorage);
+    void* result = CallerDataStorage::Allocate(size, callerAlign, &callerStorage, arena);
     return (PathOpsV0Lib::WindingData*) result;
 }
 
@@ -461,6 +542,7 @@ void OpContours::disableSmallSegments() {
                     && (a.pt == seg->c.c.data->end || a.alias == seg->c.c.data->end);
         })) {
             seg->setDisabled(OP_DEBUG_CODE(ZeroReason::isPoint));
+            ++counts.smallSegments;
         }
     }
 }
@@ -468,7 +550,8 @@ void OpContours::disableSmallSegments() {
 OpLimbStorage* OpContours::resetLimbs(OP_DEBUG_DUMP_CODE(OpTree* tree)) {
     OP_DEBUG_DUMP_CODE(dumpTree = tree);
     if (!limbStorage)
-        limbStorage = new OpLimbStorage;
+        limbStorage = arena.make<OpLimbStorage>(OpMemory::limbs);
+    release(limbStorage->nextBlock);
     limbStorage->reset();
     return limbStorage;
 }
@@ -478,27 +561,26 @@ OpLimbStorage* OpContours::resetLimbs(OP_DEBUG_DUMP_CODE(OpTree* tree)) {
 // if not, match up remainder
 // make sure normals point same way
 // prefer smaller assembled contours
-// returns true on success
 #if OP_TEST_NEW_INTERFACE
-bool OpContours::assemble() 
-#else
-bool OpContours::assemble(OpOutPath& path) 
-#endif
-{
-#if OP_TEST_NEW_INTERFACE
-    OpJoiner joiner(*this);
+// returns paused if budget runs out; call again to resume
+FoundLinks OpContours::assemble(size_t& budget) {
+    if (!resolveJoiner) {
+        resolveJoiner = arena.make<OpJoiner>(OpMemory::resolve, *this);  // collect active edges and sort them
+        if (resolveJoiner->setup())
+            return FoundLinks::yes;
+    }
+    return resolveJoiner->linkPasses(budget);
+}
 #else
+// returns true on success
+bool OpContours::assemble(OpOutPath& path) {
     OpJoiner joiner(*this, path);  // collect active edges and sort them
-#endif
     if (joiner.setup())
         return true;
-    for (LinkPass linkPass : { LinkPass::normal, LinkPass::unsectable } ) {
-        joiner.linkUnambiguous(linkPass);
-        if (joiner.linkRemaining(OP_DEBUG_CODE(this)))
-            return true;
-    }
-    return false;
+    size_t budget = std::numeric_limits<size_t>::max();
+    return FoundLinks::yes == joiner.linkPasses(budget);
 }
+#endif
 
 bool OpContours::debugFail() const {
 #if OP_DEBUG
@@ -524,12 +606,12 @@ static const bool OutInverse[+OpOperator::ReverseSubtract + 1][2][2] {
 // The callouts are removed when not in use as they are not maintained and reduce readability.
 // !!! OP_DEBUG_COUNT was unintentionally deleted at some point. Hopefully it is in git history...
 #if OP_TEST_NEW_INTERFACE
-bool OpContours::pathOps()
+bool OpContours::pathOps() {
+    (void) resolveStep(std::numeric_limits<size_t>::max());
+    return ResolvePhase::done == resolvePhase;
+}
 #else
-bool OpContours::pathOps(OpOutPath& result)
-#endif
-{
-#if !OP_TEST_NEW_INTERFACE
+bool OpContours::pathOps(OpOutPath& result) {
     if (!build(*leftIn, OpOperand::left))  // builds monotonic segments, and adds 0/1 sects
         OP_DEBUG_FAIL(*this, false);
     if (!build(*rightIn, OpOperand::right))
@@ -542,46 +624,146 @@ bool OpContours::pathOps(OpOutPath& result)
         OP_DEBUG_SUCCESS(*this, true);
     }
     sortedSegments.findCoincidences();  // check for exact curves and full lines
-    if (FoundIntersections::fail == sortedSegments.findIntersections())
+    size_t budget = std::numeric_limits<size_t>::max();
+    if (FoundIntersections::fail == sortedSegments.findIntersections(budget))
         return false;  // triggered by fuzzhang_1
     if (contours.empty())
         OP_DEBUG_SUCCESS(*this, true);
-#endif
-    {
-        OpSegments::FindCoincidences(this);
-        OpSegments sortedSegments(*this);
-        if (!sortedSegments.inX.size()) {
-            contextCallBacks.emptyNativePath(callerOutput);
-            OP_DEBUG_SUCCESS(*this, true);
-        }
-        if (FoundIntersections::fail == sortedSegments.findIntersections())
-            return false;  // !!! fix this to record for Error()
-        disableSmallSegments();  // moved points may allow disabling some segments
-        if (empty()) {
-            contextCallBacks.emptyNativePath(callerOutput);
-            OP_DEBUG_SUCCESS(*this, true);
-        }
-    }
     sortIntersections();
     makeEdges();
-
-    // made edges may include lines that are coincident with other edges. Undetected for now...
     windCoincidences();  // for segment h/v lines, compute their winding considering coincidence
     OpWinder windingEdges(*this, EdgesToSort::byCenter);
-    FoundWindings foundWindings = windingEdges.setWindings(this);  // walk edges, compute windings
+    FoundWindings foundWindings = windingEdges.setWindings(this, budget);
     if (FoundWindings::fail == foundWindings)
         OP_DEBUG_FAIL(*this, false);
     OP_DEBUG_DUMP_CODE(debugContext = "apply");
     apply();  // suppress edges which don't meet op criteria
-#if OP_TEST_NEW_INTERFACE
-    if (!assemble())
-        OP_DEBUG_FAIL(*this, false);
-#else
     if (!assemble(result))
         OP_DEBUG_FAIL(*this, false);
     bool inverseFill = OutInverse[+opOperator][leftIn->isInverted()][rightIn->isInverted()];
     result.setInverted(inverseFill);
+    OP_DEBUG_SUCCESS(*this, true);
+}
 #endif
+
+// Does up to budget units of work, then returns so the caller can do something else.
+// A unit is a segment pair when intersecting, an edge when winding, and a link when joining.
+// Returns true once the resolve has finished, successfully or not.
+bool OpContours::resolveStep(size_t budget) {
+    if (ResolvePhase::done == resolvePhase || ResolvePhase::fail == resolvePhase)
+        restartResolve();
+    stepsToClock = 0;  // check the time limit at the first unit of each step
+    OpRootCounts rootCounts = OpMath::RootCounts;
+    bool finished = resolvePhases(budget);
+    counts.floatRoots += OpMath::RootCounts.floatPath - rootCounts.floatPath;
+    counts.doubleRoots += OpMath::RootCounts.doublePath - rootCounts.doublePath;
+    if (!finished)
+        return false;
+    if (arena.refused && ResolvePhase::done == resolvePhase) {  // refused after last check
+        arena.refused = false;
+        setError(PathOpsV0Lib::ContextError::memoryLimit);
+        resolvePhase = ResolvePhase::fail;
+    }
+    if (contourNesting && ResolvePhase::done == resolvePhase)
+        outputNesting();
+    if (meshOutput && ResolvePhase::done == resolvePhase)
+        outputMesh();
+    if (coverageMask.pixels && ResolvePhase::done == resolvePhase)
+        outputCoverage();
+    if (measureOutput && ResolvePhase::done == resolvePhase)
+        outputMeasures();
+    cancel = false;  // cancel stops only the resolve in progress
+    if (contextCallBacks.outputDone)
+        contextCallBacks.outputDone(callerOutput);
+    return true;
+}
+
+// contours are output by the joiner as each one is closed
+bool OpContours::resolvePhases(size_t budget) {
+    if (ResolvePhase::start == resolvePhase) {
+        resolveStart = std::chrono::steady_clock::now();
+        outputEdges.clear();
+        flatPoints.clear();
+        flatEnds.clear();
+        FreeState(arena, containsIndex);
+        counts = { 0, 0, 0, 0, 0, 0 };
+        for (auto contour : contours)
+            contour->saveSegments();
+        OpSegments::FindCoincidences(this);
+        resolveSegments = arena.make<OpSegments>(OpMemory::resolve, *this);
+        resolvePhase = ResolvePhase::intersect;
+        if (limits.maxSegments && resolveSegments->inX.size() > limits.maxSegments) {
+            setError(PathOpsV0Lib::ContextError::segmentLimit);
+            return resolvePaused();
+        }
+        if (!resolveSegments->inX.size()) {
+            releaseResolve();
+            contextCallBacks.emptyNativePath(callerOutput);
+            resolvePhase = ResolvePhase::done;
+            OP_DEBUG_SUCCESS(*this, true);
+        }
+    }
+    if (ResolvePhase::intersect == resolvePhase) {
+        FoundIntersections foundSects = resolveSegments->findIntersections(budget);
+        if (FoundIntersections::paused == foundSects)
+            return resolvePaused();
+        releaseResolve();
+        if (FoundIntersections::fail == foundSects) {
+            setError(PathOpsV0Lib::ContextError::intersection);
+            resolvePhase = ResolvePhase::fail;
+            return true;
+        }
+        disableSmallSegments();  // moved points may allow disabling some segments
+        if (empty()) {
+            contextCallBacks.emptyNativePath(callerOutput);
+            resolvePhase = ResolvePhase::done;
+            OP_DEBUG_SUCCESS(*this, true);
+        }
+        sortIntersections();
+        makeEdges();
+        if (limits.maxEdges) {
+            size_t edgeCount = 0;
+            for (auto contour : contours) {
+                for (auto& segment : contour->segments)
+                    edgeCount += segment.edges.size();
+            }
+            if (edgeCount > limits.maxEdges) {
+                setError(PathOpsV0Lib::ContextError::edgeLimit);
+                return resolvePaused();
+            }
+        }
+        // made edges may include lines that are coincident with other edges. Undetected for now...
+        windCoincidences();  // for segment h/v lines, compute their winding considering coincidence
+        resolveWinder = arena.make<OpWinder>(OpMemory::resolve, *this, EdgesToSort::byCenter);
+        resolvePhase = ResolvePhase::wind;
+    }
+    if (ResolvePhase::wind == resolvePhase) {
+        // walk edges, compute windings
+        FoundWindings foundWindings = resolveWinder->setWindings(this, budget);
+        if (FoundWindings::paused == foundWindings)
+            return resolvePaused();
+        releaseResolve();
+        if (FoundWindings::fail == foundWindings) {
+            setError(PathOpsV0Lib::ContextError::winding);
+            resolvePhase = ResolvePhase::fail;
+            OP_DEBUG_FAIL(*this, true);
+        }
+        OP_DEBUG_DUMP_CODE(debugContext = "apply");
+        apply();  // suppress edges which don't meet op criteria
+        resolvePhase = ResolvePhase::link;
+    }
+    if (ResolvePhase::link == resolvePhase) {
+        FoundLinks foundLinks = assemble(budget);
+        if (FoundLinks::paused == foundLinks)
+            return resolvePaused();
+        releaseResolve();
+        if (FoundLinks::fail == foundLinks) {
+            setError(PathOpsV0Lib::ContextError::assemble);
+            resolvePhase = ResolvePhase::fail;
+            OP_DEBUG_FAIL(*this, true);
+        }
+        resolvePhase = ResolvePhase::done;
+    }
     // !!! missing final step to reverse order of contours as winding rule requires
     // this should be driven by user choices since the engine itself can't know the winding rule
     // it does require all output contours to be completed first. Perhaps the link-to-path
@@ -597,19 +779,215 @@ bool OpContours::pathOps(OpOutPath& result)
 void OpContours::release(OpEdgeStorage*& edgeStorage) {
     while (edgeStorage) {
         OpEdgeStorage* next = edgeStorage->next;
-        delete edgeStorage;
+        arena.destroy(edgeStorage, OpMemory::edges);
         edgeStorage = next;
     }
 }
 
+void OpContours::release(OpSectStorage*& sectBlock) {
+    while (sectBlock) {
+        OpSectStorage* next = sectBlock->next;
+        arena.destroy(sectBlock, OpMemory::intersections);
+        sectBlock = next;
+    }
+}
+
+// frees limb blocks linked by next block, leaving the caller's pointer dangling
+void OpContours::release(OpLimbStorage* limbBlock) {
+    while (limbBlock) {
+        OpLimbStorage* next = limbBlock->nextBlock;
+        arena.destroy(limbBlock, OpMemory::limbs);
+        limbBlock = next;
+    }
+}
+
+void OpContours::outputCoverage() {
+    OpCoverage coverage(coverageMask);
+    coverage.addContours(flatPoints, flatEnds);
+    coverage.write();
+}
+
+void OpContours::outputFlat(const OpCurve& curve, bool firstPt, bool lastPt) {
+    if (firstPt)
+        flatPoints.push_back(curve.firstPt());
+    curve.flatten(flatTolerance, flatPoints);
+    if (lastPt)
+        flatEnds.push_back(flatPoints.size());
+}
+
+// Curves are split at their extrema when added, so their ends describe their bounds.
+// Output contours may turn either way, so each contour's area is added if it is enclosed by
+// an even number of contours, and subtracted if odd.
+void OpContours::outputMeasures() {
+    OpPointBounds bounds;
+    float area = 0;
+    float perimeter = 0;
+    OpArray<OpPoint> points;
+    OpArray<OpCurve> curves;
+    for (int index = 0; index < (int) outputEdges.size(); ++index) {
+        curves.clear();
+        outputContour(index, curves);
+        float contourArea = 0;
+        for (const OpCurve& curve : curves) {
+            bounds.add(curve.firstPt());
+            bounds.add(curve.lastPt());
+            contourArea += curve.area(measureTolerance);
+            points.assign(1, curve.firstPt());
+            curve.flatten(measureTolerance, points);
+            for (size_t ptIndex = 1; ptIndex < points.size(); ++ptIndex)
+                perimeter += (points[ptIndex] - points[ptIndex - 1]).length();
+        }
+        int parent;
+        int depth = nesting(index, parent);
+        if (depth < 0)
+            depth = containsIndexed().depths[index];
+        area += depth & 1 ? -fabsf(contourArea) : fabsf(contourArea);
+    }
+    if (!bounds.isSet())
+        bounds = { 0, 0, 0, 0 };
+    measureOutput(callerOutput, { bounds, area, perimeter });
+}
+
+// appends the curves of the output contour, in output direction. Output reversed the curves of
+// edges linked end first in place, so each edge's curve is already in output direction.
+void OpContours::outputContour(int index, OpArray<OpCurve>& curves) const {
+    const OpEdge* first = outputEdges[index];
+    const OpEdge* edge = first;
+    do {
+        OP_ASSERT(index == edge->outputIndex);
+        curves.push_back(edge->curve());
+        edge = edge->nextEdge;
+    } while (edge && first != edge);
+}
+
+void OpContours::outputMesh() {
+    OpMesh mesh;
+    mesh.addContours(flatPoints, flatEnds);
+    mesh.triangulate();
+    meshOutput(callerOutput, mesh.vertices.data(), mesh.vertices.size(), mesh.indices.data(),
+            mesh.indices.size());
+}
+
+// An output contour is inside another if a ray from one of its edges crosses the other an odd
+// number of times. The ray already records the edges it crosses in order, so toggling each
+// crossed output contour leaves the enclosing contours, innermost last.
+// returns the number of output contours enclosing this one, and sets the innermost, if any;
+// returns -1 with no parent if no edge of the contour has a ray that found it
+int OpContours::nesting(int index, int& parent) const {
+    OpArray<int> enclosing;
+    const OpEdge* first = outputEdges[index];
+    const OpEdge* edge = first;
+    do {
+        OP_ASSERT(index == edge->outputIndex);
+        const auto& distances = edge->ray.distances;
+        auto self = std::find_if(distances.begin(), distances.end(), 
+                [edge](const EdgeDistance& dist) { return edge == dist.edge; });
+        if (distances.end() != self) {
+            for (auto dist = distances.begin(); dist != self; ++dist) {
+                int crossed = dist->edge->outputIndex;
+                if (!dist->edge->inOutput || crossed < 0 || index == crossed)
+                    continue;
+                auto found = std::find(enclosing.begin(), enclosing.end(), crossed);
+                if (enclosing.end() != found)
+                    enclosing.erase(found);
+                else
+                    enclosing.push_back(crossed);
+            }
+            parent = enclosing.size() ? enclosing.back() : -1;
+            return (int) enclosing.size();
+        }
+        edge = edge->nextEdge;
+    } while (edge && first != edge);
+    parent = -1;
+    return -1;
+}
+
+void OpContours::outputNesting() {
+    for (int index = 0; index < (int) outputEdges.size(); ++index) {
+        int parent;
+        int depth = nesting(index, parent);
+        if (depth < 0)  // no ray; find the contours enclosing a point on this one instead
+            depth = containsIndexed().enclosing(index, parent);
+        contourNesting(callerOutput, index, parent, depth);
+    }
+}
+
+// called when a phase stops early; returns true if stopped for good by cancel or a limit
+bool OpContours::resolvePaused() {
+    if (PathOpsV0Lib::ContextError::none == error)
+        return false;
+    releaseResolve();
+    resolvePhase = ResolvePhase::fail;
+    return true;
+}
+
+// builds the index the first time, after output is complete
+const OpContains& OpContours::containsIndexed() {
+    OP_ASSERT(ResolvePhase::done == resolvePhase);
+    if (!containsIndex)
+        containsIndex = arena.make<OpContains>(OpMemory::resolve, *this);
+    return *containsIndex;
+}
+
+int OpContours::containsWinding(OpPoint pt) {
+    return containsIndexed().winding(pt);
+}
+
+// a finished resolve leaves segments intersected and joined; undo that so that the context
+// can be resolved again, with any curves added since
+void OpContours::restartResolve() {
+    for (auto contour : contours)
+        contour->restoreSegments();
+    aliases.clear();
+    release(ccStorage);
+    release(fillerStorage);
+    release(sectStorage);
+    error = PathOpsV0Lib::ContextError::none;
+    resolvePhase = ResolvePhase::start;
+}
+
+// frees state kept between calls to resolve step
+void OpContours::releaseResolve() {
+    FreeState(arena, resolveSegments);
+    FreeState(arena, resolveWinder);
+    FreeState(arena, resolveJoiner);
+}
+
 void OpContours::reuse(OpEdgeStorage* edgeStorage) {
     OpEdgeStorage* next = edgeStorage;
     while (next) {
-        next->used = 0;
+        next->reset();
         next = next->next;
     }
 }
 
+// keeps the first error found
+void OpContours::setError(PathOpsV0Lib::ContextError e) {
+    if (PathOpsV0Lib::ContextError::none == error)
+        error = e;
+}
+
+OpPoint OpContours::snap(OpPoint pt) const {
+    if (snapGrid <= 0)
+        return pt;
+    return { std::round(pt.x / snapGrid) * snapGrid, std::round(pt.y / snapGrid) * snapGrid };
+}
+
+// Moves each intersection to the nearest grid point, and its opposite to the same point, so
+// that every edge starts and ends on the grid. Edges are built from their ends, so each is
+// reshaped to reach its moved ends; one whose ends meet after snapping is disabled.
+void OpContours::snapIntersections() {
+    for (auto contour : contours) {
+        for (auto& segment : contour->segments) {
+            for (OpIntersection* sect : segment.sects.i) {
+                sect->ptT.pt = snap(sect->ptT.pt);
+                if (sect->opp)
+                    sect->opp->ptT.pt = sect->ptT.pt;
+            }
+        }
+    }
+}
+
 void OpContours::sortIntersections() {
     for (auto contour : contours) {
         for (auto& segment : contour->segments) {
@@ -621,8 +999,35 @@ void OpContours::sortIntersections() {
             segment.sects.mergeNear();
         }
     }
+    if (snapGrid > 0)
+        snapIntersections();
 }
 
+// spends one unit of budget; returns true if step should stop because budget is spent,
+// or because resolve was cancelled or has run out of time (which also sets the error)
+bool OpContours::stopStep(size_t& budget) {
+    if (cancel) {
+        setError(PathOpsV0Lib::ContextError::cancelled);
+        return true;
+    }
+    if (limits.maxMilliseconds && !stepsToClock--) {
+        stepsToClock = OpClockCheckSteps - 1;
+        if (std::chrono::steady_clock::now() - resolveStart
+                > std::chrono::milliseconds(limits.maxMilliseconds)) {
+            setError(PathOpsV0Lib::ContextError::timeLimit);
+            return true;
+        }
+    }
+    if ((limits.maxBytes && arena.reserved > limits.maxBytes) || arena.refused) {
+        arena.refused = false;
+        setError(PathOpsV0Lib::ContextError::memoryLimit);
+        return true;
+    }
+    if (!budget)
+        return true;
+    --budget;
+    return false;
+}
 
 #if OP_DEBUG
 void OpContour::debugComplete() {
@@ -639,7 +1044,7 @@ bool OpContours::debugSuccess() const {
 SegmentIterator::SegmentIterator(OpContours* c)
     : contours(c)
     , contourIterator(c)
-    , contourIter(c)
+    , contourIter(c, 0)
     , segIndex(-1) 
     OP_DEBUG_PARAMS(debugEnded(false)) {
 }
@@ -663,8 +1068,3 @@ OpSegment* SegmentIterator::next() {
     return s;
 }
 
-OpContourIter::OpContourIter(OpContours* contours) {
-    storage = contours->contourStorage;
-	contourIndex = 0;
-}
-
@@ -2,12 +2,13 @@
 #ifndef OpContour_DEFINED
 #define OpContour_DEFINED
 
+#include "OpArena.h"
 #include "OpJoiner.h"
 #include "OpTightBounds.h"
-#include <vector>
-#if OP_DEBUG
 #include <atomic>
-#endif
+#include <chrono>
+#include <thread>
+#include <vector>
 
 enum class EdgeMatch : int8_t;
 struct FoundEdge;
@@ -15,6 +16,9 @@ struct OpContourIterator;
 struct OpContourStorage;
 struct OpCurveCurve;
 struct OpJoiner;
+struct OpContains;
+struct OpSegments;
+struct OpWinder;
 
 enum class OpFillType {
     winding = -1,
@@ -25,6 +29,16 @@ enum class OpFillType {
 struct OpContours;
 struct OpInPath;
 
+// resolve is done in phases so that it can be paused and resumed (see ResolveStep)
+enum class ResolvePhase {
+    start,
+    intersect,  // segment pairs are intersected
+    wind,       // edge windings are computed
+    link,       // edges are joined into output contours
+    done,
+    fail
+};
+
 struct CallerDataStorage {
 	CallerDataStorage()
 		: next(nullptr)
@@ -32,15 +46,17 @@ struct CallerDataStorage {
         OP_DEBUG_CODE(memset(storage, 0, sizeof(storage)));
 	}
 
-	static char* Allocate(size_t size, CallerDataStorage** );
+	static char* Allocate(size_t size, size_t align, CallerDataStorage** , OpArena& );
 #if OP_DEBUG_DUMP
-	static void DumpSet(const char*& str, CallerDataStorage** previousPtr);
+	static void DumpSet(const char*& str, CallerDataStorage** previousPtr, OpArena& );
 	DUMP_DECLARATIONS
 #endif
 
 	CallerDataStorage* next;
 	size_t used;
-	char storage[2048];	// !!! size is arbitrary guess -- should measure and do better
+	// sized so the block fills an arena size class; caller data is usually a few bytes per
+	// contour or segment, so the unused end of the last block bounds the waste
+	char storage[2048 - sizeof(CallerDataStorage*) - sizeof(size_t)];
 };
 
 struct OpContour {
@@ -63,6 +79,9 @@ struct OpContour {
     OpIntersection* addEdgeSect(const OpPtT& , OpSegment* seg
            OP_LINE_FILE_DEF(SectReason , const OpEdge* edge, const OpEdge* oEdge));
     OpEdge* addFiller(OpEdge* edge, OpEdge* lastEdge);
+#if OP_TEST_NEW_INTERFACE
+    bool addFlattened(PathOpsV0Lib::AddCurve , PathOpsV0Lib::AddWinding );
+#endif
     OpEdge* addFiller(OpIntersection* start, OpIntersection* end);
     OpIntersection* addCoinSect(const OpPtT& , OpSegment* seg, int cID, MatchEnds 
             OP_LINE_FILE_DEF(SectReason , const OpSegment* oSeg));
@@ -86,6 +105,10 @@ struct OpContour {
     }
 
     int nextID() const;
+#if OP_TEST_NEW_INTERFACE
+    void restoreSegments();
+    void saveSegments();
+#endif
 
 #if 0  // !!! disable until use case appears
     void setBounds() {
@@ -117,12 +140,14 @@ struct OpContour {
 #endif
 
     OpContours* contours;
-    std::vector<OpSegment> segments;
+    OpArray<OpSegment> segments;
     PathOpsV0Lib::ContourCallBacks callBacks;
 
 //    OpPointBounds ptBounds;
 #if OP_TEST_NEW_INTERFACE
     PathOpsV0Lib::CallerData caller;  // note: must use std::memcpy before reading
+    OpArray<char> saved;  // curve and winding data of the first saved count segments, as added
+    size_t savedCount;
 #else
     OpOperand operand; // first or second argument to a binary operator
 #endif
@@ -131,60 +156,42 @@ struct OpContour {
 #endif
 };
 
+constexpr uint32_t OpContourBlock = 16;  // contours per storage block
+constexpr size_t OpClockCheckSteps = 64;  // budget units between reads of the clock
+
+// contours don't move once allocated: callers hold them as Contour handles, and segments point
+// to them. Blocks are listed in allocation order, so a 32-bit index addresses a contour. Only
+// contour storage is indexed; segments, edges and intersections are still reached by pointer.
+// Engine results depend on the order contours are visited, so iteration keeps the order of the
+// former two-contour blocks: newest pair first, each pair oldest first.
 struct OpContourStorage {
 	OpContourStorage()
-		: next(nullptr)
-		, used(0) {
+		: used(0) {
 	}
 #if OP_DEBUG_DUMP
-	size_t debugCount() const;
-	OpContour* debugFind(int id) const;
-	OpContour* debugIndex(int index) const;
 	static void DumpSet(const char*& , OpContours* );
-	DUMP_DECLARATIONS
 #endif
 
-	OpContourStorage* next;
-	OpContour storage[2];
-	int used;
+	OpContour storage[OpContourBlock];
+	uint32_t used;
 };
 
 struct OpContourIter {
-    OpContourIter()
-        : storage(nullptr)
-        , contourIndex(0) {
+    OpContourIter(OpContours* c, uint32_t i)
+        : contours(c)
+        , index(i) {
     }
 
-    OpContourIter(OpContours* contours);
-    
     bool operator!=(OpContourIter rhs) { 
-		return storage != rhs.storage || contourIndex != rhs.contourIndex; 
+		return index != rhs.index; 
 	}
 
-    OpContour* operator*() {
-        OP_ASSERT(storage && contourIndex < storage->used);
-        return &storage->storage[contourIndex]; 
-	}
-
-    void operator++() {
-        OP_ASSERT(storage && contourIndex < storage->used); 
-		if (++contourIndex >= storage->used) {
-            contourIndex = 0;
-            storage = storage->next;
-        }
-	}
+    OpContour* operator*();
 
-    void back() {
-        OP_ASSERT(storage);
-        while (OpContourStorage* next = storage->next) {
-            storage = next;
-        }
-        OP_ASSERT(storage->used);
-        contourIndex = storage->used - 1;
-    }
+    void operator++();
 
-    OpContourStorage* storage;
-	int contourIndex;
+    OpContours* contours;
+	uint32_t index;  // allocation index of the contour visited; contour count at end
 };
 
 struct OpContourIterator {
@@ -192,26 +199,11 @@ struct OpContourIterator {
         : contours(c) {
     }
 
-    OpContour* back() {
-        OpContourIter iter;
-        iter.back();
-        return *iter;
-    }
-
-    OpContour* front() {
-        OpContourIter iter(contours);
-        return *iter;
-    }
-
-    OpContourIter begin() {
-        return OpContourIter(contours);
-    }
-
-    OpContourIter end() {
-        return OpContourIter(); 
-    }
-
-	bool empty() { return !(begin() != end()); }
+    OpContour* back() const;
+    OpContour* front() const;
+    OpContourIter begin() const;
+    OpContourIter end() const;
+	bool empty() const { return !(begin() != end()); }
 
     OpContours* contours;
 };
@@ -255,7 +247,7 @@ struct OpContours {
     }
 
 #if OP_TEST_NEW_INTERFACE
-    bool assemble();
+    FoundLinks assemble(size_t& budget);
 #else
     bool assemble(OpOutPath& );
     bool build(OpInPath& path, OpOperand operand);   // provided by graphics implementation
@@ -265,9 +257,27 @@ struct OpContours {
         return callBacks[(int) type - 1];
     }
 
+    const OpContains& containsIndexed();
+    int containsWinding(OpPoint );
+
+    OpContour* contour(uint32_t index) {
+        OP_ASSERT(index < contourCount);
+        return &contourStorage[index / OpContourBlock]->storage[index % OpContourBlock];
+    }
+
 //    WindingData* copySect(const OpWinding& );  // !!! add a separate OpWindingStorage for temporary blocks?
     void disableSmallSegments();
 
+    // false if a direct output mode replaces curve output
+    bool curveOutput() const {
+        return !flatOutput() && !measureOutput;
+    }
+
+    // true if output is gathered as lines instead of sent to curve output
+    bool flatOutput() const {
+        return meshOutput || coverageMask.pixels;
+    }
+
     bool empty() {
         for (auto contour : contours) {
             if (contour->segments.size())
@@ -286,6 +296,7 @@ struct OpContours {
     OpContour* makeContour() {
         OpContour* contour = allocateContour();
         contour->contours = this;
+        contour->savedCount = 0;
         OP_DEBUG_CODE(contour->debugComplete());
         return contour;
     }
@@ -312,8 +323,22 @@ struct OpContours {
 #else
     bool pathOps(OpOutPath& result);
 #endif
+    int nesting(int index, int& parent) const;
+    void outputContour(int index, OpArray<OpCurve>& curves) const;
+    void outputCoverage();
+    void outputFlat(const OpCurve& , bool firstPt, bool lastPt);
+    void outputMeasures();
+    void outputMesh();
+    void outputNesting();
     void release(OpEdgeStorage*& );
+    void release(OpLimbStorage* );
+    void release(OpSectStorage*& );
+    void releaseResolve();
     OpLimbStorage* resetLimbs(OP_DEBUG_DUMP_CODE(OpTree* tree));
+    bool resolvePaused();
+    bool resolvePhases(size_t budget);
+    void restartResolve();
+    bool resolveStep(size_t budget);
     void reuse(OpEdgeStorage* );
 
 #if !OP_TEST_NEW_INTERFACE
@@ -336,7 +361,11 @@ struct OpContours {
     }
 #endif
 
+    void setError(PathOpsV0Lib::ContextError );
+    OpPoint snap(OpPoint ) const;
+    void snapIntersections();
     void sortIntersections();
+    bool stopStep(size_t& budget);
 
     void windCoincidences() {
         for (auto contour : contours) {
@@ -379,21 +408,24 @@ struct OpContours {
     #include "OpDebugDeclarations.h"
 #endif
 
+    OpArena arena;  // supplies storage blocks and containers; first, so it is destroyed last
 #if !OP_TEST_NEW_INTERFACE
     OpInPath* leftIn;
     OpInPath* rightIn;
     OpOperator opIn;
 #endif
-    std::vector<OpPtAlias> aliases;
+    OpArray<OpPtAlias> aliases;
     // these are pointers instead of inline values because the storage with empty slots is first
     OpEdgeStorage* ccStorage;
     CurveDataStorage* curveDataStorage;
-    OpContourStorage* contourStorage;
+    OpArray<OpContourStorage*> contourStorage;  // in allocation order; last has empty slots
+    uint32_t contourCount;
     OpContourIterator contours;
     OpEdgeStorage* fillerStorage;
     OpSectStorage* sectStorage;
     OpLimbStorage* limbStorage;
     CallerDataStorage* callerStorage;
+    size_t callerAlign;  // alignment of contour and winding caller data
 #if !OP_TEST_NEW_INTERFACE
     OpFillType left;
     OpFillType right;
@@ -402,10 +434,37 @@ struct OpContours {
     int uniqueID;  // used for object id, unsectable id, coincidence id
 
 // new interface ..
-    std::vector<PathOpsV0Lib::CurveCallBacks> callBacks;
+    OpArray<PathOpsV0Lib::CurveCallBacks> callBacks;
     PathOpsV0Lib::ContextCallBacks contextCallBacks;
+    PathOpsV0Lib::FreeMemory contextFree;  // set if create context used the caller's allocator
+    void* contextFreeUser;
     PathOpsV0Lib::PathOutput callerOutput;
+    PathOpsV0Lib::ContourNesting contourNesting;  // optional; null if nesting is not reported
     PathOpsV0Lib::AddContext caller;   // note: must use std::memcpy before reading
+    // state kept between calls to resolve step
+    OpSegments* resolveSegments;
+    OpWinder* resolveWinder;
+    OpJoiner* resolveJoiner;
+    ResolvePhase resolvePhase;
+    std::chrono::steady_clock::time_point resolveStart;
+    size_t stepsToClock;  // budget units until the time limit is checked again
+    PathOpsV0Lib::ContextLimits limits;
+    PathOpsV0Lib::ContextError error;
+    std::atomic<bool> cancel;  // may be set by another thread
+    std::thread resolveThread;  // runs resolve async; joined by the next one or delete context
+    OpArray<OpEdge*> outputEdges;  // first edge of each output contour, in output order
+    PathOpsV0Lib::MeshOutput meshOutput;  // optional; replaces curve output with triangles
+    PathOpsV0Lib::CoverageMask coverageMask;  // optional; replaces curve output with pixels
+    PathOpsV0Lib::MeasureOutput measureOutput;  // optional; replaces curve output with measures
+    float measureTolerance;  // greatest distance from curve to line when measuring length
+    OpType flattenLineType;  // caller's line type, used when input curves are flattened
+    float flattenTolerance;  // if nonzero, input curves are replaced by lines
+    float snapGrid;  // if nonzero, input ends and intersections are rounded to this grid
+    PathOpsV0Lib::ContextCounts counts;
+    float flatTolerance;  // greatest distance from curve to line approximation
+    OpArray<OpPoint> flatPoints;  // output contours approximated by lines
+    OpArray<size_t> flatEnds;  // end of each output contour in flat points
+    OpContains* containsIndex;  // built on first call to contains
 #if OP_DEBUG_VALIDATE
     int debugValidateEdgeIndex;
     int debugValidateJoinerIndex;
@@ -439,4 +498,33 @@ struct OpContours {
 #endif
 };
 
+inline OpContour* OpContourIter::operator*() {
+    return contours->contour(index);
+}
+
+// see OpContourStorage for the visit order
+inline void OpContourIter::operator++() {
+    if (!(index & 1) && index + 1 < contours->contourCount)
+        ++index;
+    else
+        index = index > 1 ? (index & ~1u) - 2 : contours->contourCount;
+}
+
+inline OpContour* OpContourIterator::back() const {
+    return contours->contour(contours->contourCount - 1);
+}
+
+inline OpContour* OpContourIterator::front() const {
+    return *begin();
+}
+
+inline OpContourIter OpContourIterator::begin() const {
+    uint32_t count = contours->contourCount;
+    return OpContourIter(contours, count ? (count - 1) & ~1u : count);
+}
+
+inline OpContourIter OpContourIterator::end() const {
+    return OpContourIter(contours, contours->contourCount);
+}
+
 #endif
\ No newline at end of file
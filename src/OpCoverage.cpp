@@ -0,0 +1,125 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#include "OpCoverage.h"
+
+OpCoverage::OpCoverage(const PathOpsV0Lib::CoverageMask& m)
+	: mask(m)
+	, stride(m.width + 2) {
+	area.resize(stride * m.height);
+}
+
+// Adds the area between the line and the pixel's right edge to the pixels it touches, and
+// the remainder to the pixel to the right, so that a running sum along the row is the
+// coverage. Expects x to be within the mask.
+void OpCoverage::accumulate(OpPoint p0, OpPoint p1) {
+	if (p0.y == p1.y)
+		return;
+	float dir = 1;
+	if (p0.y > p1.y) {
+		std::swap(p0, p1);
+		dir = -1;
+	}
+	if (p1.y <= 0 || p0.y >= mask.height)
+		return;
+	float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+	float x = p0.x;
+	if (p0.y < 0)
+		x -= p0.y * dxdy;
+	int yEnd = std::min(mask.height, (int) std::ceil(p1.y));
+	for (int y = std::max(0, (int) p0.y); y < yEnd; ++y) {
+		float* row = &area[y * stride];
+		float dy = std::min(y + 1.f, p1.y) - std::max((float) y, p0.y);
+		float xNext = std::min((float) mask.width, std::max(0.f, x + dxdy * dy));
+		float d = dy * dir;
+		float x0 = std::min(x, xNext);
+		float x1 = std::max(x, xNext);
+		float x0Floor = std::floor(x0);
+		int x0i = (int) x0Floor;
+		float x1Ceil = std::ceil(x1);
+		int x1i = (int) x1Ceil;
+		if (x1i <= x0i + 1) {  // line is within one pixel column
+			float xMid = OpMath::Average(x, xNext) - x0Floor;
+			row[x0i] += d - d * xMid;
+			row[x0i + 1] += d * xMid;
+		} else {
+			float s = 1 / (x1 - x0);
+			float x0f = x0 - x0Floor;
+			float a0 = .5f * s * (1 - x0f) * (1 - x0f);
+			float x1f = x1 - x1Ceil + 1;
+			float am = .5f * s * x1f * x1f;
+			row[x0i] += d * a0;
+			if (x1i == x0i + 2)
+				row[x0i + 1] += d * (1 - a0 - am);
+			else {
+				float a1 = s * (1.5f - x0f);
+				row[x0i + 1] += d * (a1 - a0);
+				for (int xi = x0i + 2; xi < x1i - 1; ++xi)
+					row[xi] += d * s;
+				float a2 = a1 + (x1i - x0i - 3) * s;
+				row[x1i - 1] += d * (1 - a2 - am);
+			}
+			row[x1i] += d * am;
+		}
+		x = xNext;
+	}
+}
+
+void OpCoverage::addContours(const OpArray<OpPoint>& points, 
+		const OpArray<size_t>& ends) {
+	size_t start = 0;
+	for (size_t end : ends) {
+		for (size_t index = start; index < end; ++index) {
+			OpPoint next = points[index + 1 < end ? index + 1 : start];  // close contour
+			addLine(transform(points[index]), transform(next));
+		}
+		start = end;
+	}
+}
+
+// Lines are split where they cross the left and right mask edges, and the parts outside
+// are moved to the edge. Moved parts keep their vertical extent, so they still add coverage
+// to the pixels to their right.
+void OpCoverage::addLine(OpPoint p0, OpPoint p1) {
+	float ts[4] = { 0, OpNaN, OpNaN, 1 };
+	if (p0.x != p1.x) {
+		ts[1] = (0 - p0.x) / (p1.x - p0.x);
+		ts[2] = (mask.width - p0.x) / (p1.x - p0.x);
+		if (ts[1] > ts[2])
+			std::swap(ts[1], ts[2]);
+	}
+	OpPoint last = p0;
+	for (float t : { ts[1], ts[2], ts[3] }) {
+		if (!(t > 0 && t <= 1))  // skips NaN
+			continue;
+		OpPoint next = 1 == t ? p1 : OpMath::Interp(p0, p1, t);
+		OpPoint clampLast { std::min((float) mask.width, std::max(0.f, last.x)), last.y };
+		OpPoint clampNext { std::min((float) mask.width, std::max(0.f, next.x)), next.y };
+		accumulate(clampLast, clampNext);
+		last = next;
+	}
+}
+
+// flatten curves to within a quarter pixel
+float OpCoverage::Tolerance(const PathOpsV0Lib::CoverageMask& m) {
+	float scale = std::max(std::hypot(m.scaleX, m.skewY), std::hypot(m.skewX, m.scaleY));
+	if (!(scale > 0) || !OpMath::IsFinite(scale))
+		return .25f;
+	return .25f / scale;
+}
+
+OpPoint OpCoverage::transform(OpPoint pt) const {
+	return { pt.x * mask.scaleX + pt.y * mask.skewX + mask.transX,
+			pt.x * mask.skewY + pt.y * mask.scaleY + mask.transY };
+}
+
+void OpCoverage::write() {
+	for (int y = 0; y < mask.height; ++y) {
+		const float* row = &area[y * stride];
+		uint8_t* pixels = mask.pixels + y * mask.rowBytes;
+		float sum = 0;
+		for (int x = 0; x < mask.width; ++x) {
+			sum += row[x];
+			float coverage = std::min(1.f, std::abs(sum - 2 * std::round(sum / 2)));
+			pixels[x] = (uint8_t) (coverage * 255 + .5f);
+		}
+	}
+}
@@ -0,0 +1,25 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef OpCoverage_DEFINED
+#define OpCoverage_DEFINED
+
+#include "OpArena.h"
+
+// Accumulates the signed area each line covers in each pixel, then sums each row left to right
+// to find the winding coverage. Output contours never cross, but may turn either way, so the
+// winding of a hole may be two as well as zero. Coverage is found with the even-odd rule:
+// the distance from the sum to the nearest even winding.
+struct OpCoverage {
+	OpCoverage(const PathOpsV0Lib::CoverageMask& );
+	void accumulate(OpPoint p0, OpPoint p1);
+	void addContours(const OpArray<OpPoint>& points, const OpArray<size_t>& ends);
+	void addLine(OpPoint p0, OpPoint p1);
+	static float Tolerance(const PathOpsV0Lib::CoverageMask& );
+	OpPoint transform(OpPoint ) const;
+	void write();
+
+	const PathOpsV0Lib::CoverageMask& mask;
+	OpArray<float> area;  // signed area per pixel; rows have two extra entries at the right
+	size_t stride;
+};
+
+#endif
@@ -211,8 +211,10 @@ OpPtT OpCurve::findIntersect(Axis axis, const OpPtT& opPtT) const {
     OP_ASSERT(roots.count);
     OpPtT result;
     float best = OpInfinity;
+    OpPoint pts[sizeof(roots.roots) / sizeof(roots.roots[0])];
+    ptAtTs(&roots.roots[0], pts, roots.count);
     for (unsigned index = 0; index < roots.count; ++index) {
-        OpPoint pt = ptAtT(roots.roots[index]);
+        OpPoint pt = pts[index];
         float distance = fabsf(*(&pt.y - +axis) - *(&opPtT.pt.y - +axis));
         if (best > distance) {
             result = { pt, roots.roots[index] };
@@ -238,7 +240,7 @@ OpRootPts OpCurve::lineIntersect(const LinePts& line) const {
 #if 0 && OP_DEBUG_IMAGE
         static int debugDraw = 0;
         if (++debugDraw == 26) {
-            std::vector<OpPtT> ptts;
+            OpArray<OpPtT> ptts;
             for (int di = -8; di < 8; ++di) {
                 float t = result.valid.roots[index] - OpEpsilon * di;
                 if (t > 0 && t < 1) {
@@ -274,16 +276,18 @@ float OpCurve::match(float start, float end, OpPoint pt) const {
 	float yRoot = tAtXY(start, end, XyChoice::inY, pt.y);
 	if (OpMath::Equalish(xRoot, yRoot))
 		return xRoot;
-    OpPoint xPt = ptAtT(xRoot);
-	OpPoint yPt = ptAtT(yRoot);
-    float xDistSq = (pt - xPt).lengthSquared();
-    float yDistSq = (pt - yPt).lengthSquared();
+    float roots[2] = { xRoot, yRoot };
+    OpPoint rootPts[2];
+    ptAtTs(roots, rootPts, 2);
+    float xDistSq = (pt - rootPts[0]).lengthSquared();
+    float yDistSq = (pt - rootPts[1]).lengthSquared();
     float closest = xDistSq < yDistSq ? xRoot : yRoot;
     // !!! can probably optimize this to give up if closest is large -- need to instrument to figure
     //     out how large large needs to be to give up safely
-    float lesser = std::max(closest - OpEpsilon, 0.f);
-    float greater = std::min(closest + OpEpsilon, 1.f);
-    OpPointBounds bounds { ptAtT(lesser), ptAtT(greater) };
+    float range[2] = { std::max(closest - OpEpsilon, 0.f), std::min(closest + OpEpsilon, 1.f) };
+    OpPoint rangePts[2];
+    ptAtTs(range, rangePts, 2);
+    OpPointBounds bounds { rangePts[0], rangePts[1] };
     if (bounds.nearlyContains(pt))
         return closest;
     return OpNaN;
@@ -338,8 +342,10 @@ OpRoots OpCurve::rayIntersect(const LinePts& line, MatchEnds common) const {
     OpRoots realRoots;
     OpVector lineV = line.pts[1] - line.pts[0];
     XyChoice xy = fabsf(lineV.dx) >= fabsf(lineV.dy) ? XyChoice::inX : XyChoice::inY;
+    OpPoint hits[sizeof(rawRoots.roots) / sizeof(rawRoots.roots[0])];
+    ptAtTs(&rawRoots.roots[0], hits, rawRoots.count);
     for (unsigned index = 0; index < rawRoots.count; ++index) {
-        OpPoint hit = ptAtT(rawRoots.roots[index]);
+        OpPoint hit = hits[index];
         // in thread_circles36945 : conic mid touches opposite conic only at end point
         // without this fix, in one direction, intersection misses by 2 epsilon, in the other 1 eps
         if (OpMath::Betweenish(line.pts[0].choice(xy), hit.choice(xy), line.pts[1].choice(xy)))
@@ -516,6 +522,18 @@ OpPoint OpCurve::ptAtT(float t) const {
 #endif
 }
 
+// evaluates several parameters in one call if the curve type provides a batch callback
+void OpCurve::ptAtTs(const float* t, OpPoint* pts, size_t count) const {
+#if OP_TEST_NEW_INTERFACE
+    if (PathOpsV0Lib::PtAtTBatch batch = contours->callBack(c.type).ptAtTBatchFuncPtr) {
+        (*batch)(c, t, pts, count);
+        return;
+    }
+#endif
+    for (size_t index = 0; index < count; ++index)
+        pts[index] = ptAtT(t[index]);
+}
+
 OpCurve OpCurve::subDivide(OpPtT ptT1, OpPtT ptT2) const {
 #if OP_TEST_NEW_INTERFACE
     PathOpsV0Lib::Curve newCurve { c.data, c.size, c.type };
@@ -724,9 +742,52 @@ OpPointBounds OpCurve::ptBounds() const {
     return result;
 }
 
+// recursion stops when the curve midpoint is within tolerance of the line midpoint; check
+// at least a few midpoints so that a cubic inflection on the line is not missed
+static void flattenRange(const OpCurve& curve, OpPtT start, OpPtT end, float tolerance,
+        int depth, OpArray<OpPoint>& points) {
+    constexpr int minDepth = 2;
+    constexpr int maxDepth = 16;
+    OpPtT mid = curve.ptTAtT(OpMath::Average(start.t, end.t));
+    if (maxDepth <= depth || (minDepth <= depth
+            && (mid.pt - OpMath::Interp(start.pt, end.pt, .5)).length() <= tolerance)) {
+        points.push_back(end.pt);
+        return;
+    }
+    flattenRange(curve, start, mid, tolerance, depth + 1, points);
+    flattenRange(curve, mid, end, tolerance, depth + 1, points);
+}
+
+// half of x dy - y dx integrated along the curve; approximated by lines if the curve type has
+// no area callback
+float OpCurve::area(float tolerance) const {
+#if OP_TEST_NEW_INTERFACE
+    if (PathOpsV0Lib::CurveArea areaFunc = contours->callBack(c.type).curveAreaFuncPtr)
+        return areaFunc(c);
+#endif
+    OpArray<OpPoint> points(1, firstPt());
+    flatten(tolerance, points);
+    float result = 0;
+    for (size_t index = 1; index < points.size(); ++index)
+        result += OpVector(points[index - 1]).cross(OpVector(points[index]));
+    return result / 2;
+}
+
+// appends the end points of lines that approximate the curve; the first point is not added
+void OpCurve::flatten(float tolerance, OpArray<OpPoint>& points) const {
+    if (isLine()) {
+        points.push_back(lastPt());
+        return;
+    }
+    flattenRange(*this, { firstPt(), 0 }, { lastPt(), 1 }, tolerance, 0, points);
+}
+
 #if OP_TEST_NEW_INTERFACE
 void OpCurve::output(bool firstPt, bool lastPt) {
-    contours->callBack(c.type).curveOutputFuncPtr(c, firstPt, lastPt, 
-            contours->callerOutput);
+    if (contours->flatOutput())
+        contours->outputFlat(*this, firstPt, lastPt);
+    if (contours->curveOutput())
+        contours->callBack(c.type).curveOutputFuncPtr(c, firstPt, lastPt, 
+                contours->callerOutput);
 }
 #endif
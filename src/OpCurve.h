@@ -2,7 +2,7 @@
 #ifndef OpCurve_DEFINED
 #define OpCurve_DEFINED
 
-#include "PathOpsTypes.h"
+#include "OpArena.h"
 #include "OpTypes.h"
 
 #define RAW_INTERSECT_LIMIT 0.00005f  // errors this large or larger mean the crossing was not found
@@ -81,6 +81,7 @@ struct OpCurve {
     const OpConic& asConic() const;
     const OpQuad& asConicQuad() const;
     const OpCubic& asCubic() const;
+    float area(float tolerance) const;
     OpRoots axisRayHit(Axis offset, float axisIntercept, float start = 0, float end = 1) const;
     OpRoots axisRawHit(Axis offset, float axisIntercept, MatchEnds ) const;
     float center(Axis offset, float axisIntercept) const;
@@ -91,6 +92,7 @@ struct OpCurve {
     OpPoint end(float t) const;
     OpPtT findIntersect(Axis offset, const OpPtT& ) const;
     OpPoint firstPt() const;
+    void flatten(float tolerance, OpArray<OpPoint>& points) const;
     OpPoint hullPt(int index) const;
     bool isFinite() const;
     bool isLine() const; 
@@ -109,6 +111,7 @@ struct OpCurve {
 #endif
     void pinCtrl();
     OpPoint ptAtT(float t) const;
+    void ptAtTs(const float* t, OpPoint* pts, size_t count) const;
     OpPtT ptTAtT(float t) const {
         return { ptAtT(t), t }; }
     OpPointBounds ptBounds() const;
@@ -267,12 +270,12 @@ struct CurveDataStorage {
     std::string debugDump(DebugLevel l, DebugBase b) const;
     std::string debugDump(PathOpsV0Lib::CurveData* ) const;
     PathOpsV0Lib::CurveData* dumpSet(const char*& str);
-	static void DumpSet(const char*& str, CurveDataStorage** previousPtr);
+	static void DumpSet(const char*& str, CurveDataStorage** previousPtr, OpArena& );
 #endif
 
 	CurveDataStorage* next;
 	size_t used;
-	char storage[sizeof(OpPoint) * 256];
+	char storage[4096 - sizeof(CurveDataStorage*) - sizeof(size_t)];  // fills an arena size class
 };
 
 #if OP_DEBUG_IMAGE  
@@ -173,8 +173,8 @@ bool CcCurves::debugHasEdgeRun(float t) const {
 }
 #endif
 
-std::vector<TGap> CcCurves::findGaps() const {
-	std::vector<TGap> gaps;
+OpArray<TGap> CcCurves::findGaps() const {
+	OpArray<TGap> gaps;
 	size_t index = 0;
 	while (index < c.size() && !c[index]->ccOverlaps)
 		++index;
@@ -491,10 +491,10 @@ bool OpCurveCurve::checkForGaps() {
 			&& (!largeTFound || !edgeCurves.c.back()->ccOverlaps || 1 != edgeCurves.c.back()->end.t))
 		return false;
 	OP_ASSERT(edgeCurves.c.size() && oppCurves.c.size());
-	std::vector<TGap> edgeGaps = edgeCurves.findGaps();
+	OpArray<TGap> edgeGaps = edgeCurves.findGaps();
 	if (edgeGaps.size() < smallTFound + largeTFound)  // require 2 gaps if sm && lg
 		return false;
-	std::vector<TGap> oppGaps = oppCurves.findGaps();
+	OpArray<TGap> oppGaps = oppCurves.findGaps();
 	if (oppGaps.size() < smallTFound + largeTFound)
 		return false;
 	if (smallTFound) {
@@ -565,7 +565,7 @@ bool OpCurveCurve::checkSect() {
 // different (but close by if possible) point to split the curve.
 bool OpCurveCurve::checkSplit(float loT, float hiT, CurveRef which, OpPtT& checkPtT) const {
 	OP_ASSERT(loT <= checkPtT.t && checkPtT.t <= hiT);
-	const std::vector<OpEdge*>& oCurves = CurveRef::edge == which ? oppCurves.c : edgeCurves.c;
+	const OpArray<OpEdge*>& oCurves = CurveRef::edge == which ? oppCurves.c : edgeCurves.c;
 	const OpCurve& eCurve = CurveRef::edge == which ? seg->c : opp->c;
 	float startingT = checkPtT.t;
 	float deltaT = OpEpsilon;
@@ -635,7 +635,10 @@ SectFound OpCurveCurve::divideAndConquer() {
 
 	// !!! testQuads5721199 segments 2 and 5 share (0, 0) but iterate depth to 24 to see if they
 	// intersect a second time. Not sure what to do...
-	for (depth = 1; depth < maxDepth; ++depth) {
+	int depthLimit = contours->limits.maxCurveCurveDepth;
+	if (!depthLimit || depthLimit > maxDepth)
+		depthLimit = maxDepth;
+	for (depth = 1; depth < depthLimit; ++depth) {
 //		edgeCurves.endDist(seg, opp);
 //		oppCurves.endDist(opp, seg);
 #if OP_DEBUG_DUMP
@@ -709,6 +712,10 @@ SectFound OpCurveCurve::divideAndConquer() {
 			oppCurves.snipAndGo(opp, snipOpp, seg);
 		}
 	}
+	if (depthLimit < maxDepth) {
+		contours->setError(PathOpsV0Lib::ContextError::curveCurveLimit);
+		return SectFound::fail;
+	}
 	OP_ASSERT(0);  // !!! if this occurs likely more code is needed
 	return SectFound::fail;
 }
@@ -838,7 +845,7 @@ bool OpCurveCurve::LineMissed(OpEdge& edge, OpEdge& opp) {
 		return false;
 	LinePts edgePts;
 	edgePts.pts = { edge.start.pt, edge.end.pt };
-	OpRootPts septs = opp.curve.lineIntersect(edgePts);
+	OpRootPts septs = opp.curve().lineIntersect(edgePts);
 	if (1 == septs.count && ((opp.ccStart && 0 == septs.valid.roots[0])
 			|| (opp.ccEnd && 1 == septs.valid.roots[0])))
 		return true;
@@ -948,18 +955,18 @@ SectFound OpCurveCurve::runsToLimits() {
 // finds intersections of opp edge's hull with edge, and stores them in edge's hulls
 // returns true if found intersection is true curve curve intersection (or at least, close enough)
 void OpCurveCurve::setHullSects(OpEdge& edge, OpEdge& oppEdge, CurveRef curveRef) {
-	int ptCount = oppEdge.curve.pointCount();
+	int ptCount = oppEdge.curve().pointCount();
 	LinePts oppPts;
-	oppPts.pts[1] = oppEdge.curve.firstPt();
+	oppPts.pts[1] = oppEdge.curve().firstPt();
 	for (int index = 1; index <= ptCount; ++index) {
 		oppPts.pts[0] = oppPts.pts[1];
 		int endHull = index < ptCount ? index : 0;
-		oppPts.pts[1] = oppEdge.curve.hullPt(endHull);
+		oppPts.pts[1] = oppEdge.curve().hullPt(endHull);
 		if (oppPts.pts[0].isNearly(oppPts.pts[1]))
 			continue;
 		// since curve/curve intersection works by keeping overlapping edge bounds, it should
 		// use edge, not segment, to find hull intersections
-		OpRootPts septs = edge.curve.lineIntersect(oppPts);
+		OpRootPts septs = edge.curve().lineIntersect(oppPts);
 		for (size_t inner = 0; inner < septs.count; ++inner) {
 			OpPtT sectPtT = septs.ptTs[inner];
 			// set to secttype endhull iff computed point is equal to or nearly an end point
@@ -995,8 +1002,8 @@ void OpCurveCurve::setHullSects(OpEdge& edge, OpEdge& oppEdge, CurveRef curveRef
 
 // if ref is edge, records all intersections of edges with all hulls of opp
 void OpCurveCurve::setHulls(CurveRef curveRef) {
-	std::vector<OpEdge*>& eCurves = CurveRef::edge == curveRef ? edgeCurves.c : oppCurves.c;
-	std::vector<OpEdge*>& oCurves = CurveRef::edge == curveRef ? oppCurves.c : edgeCurves.c;
+	OpArray<OpEdge*>& eCurves = CurveRef::edge == curveRef ? edgeCurves.c : oppCurves.c;
+	OpArray<OpEdge*>& oCurves = CurveRef::edge == curveRef ? oppCurves.c : edgeCurves.c;
 	for (auto edgePtr : eCurves) {
 		auto& edge = *edgePtr;
 		if (!edge.ccOverlaps)
@@ -86,7 +86,7 @@ struct CcCurves {
 	OpPtT closest(OpPoint pt) const;
 	static OpPtT Dist(const OpSegment* , const OpPtT& segPtT, const OpSegment* opp);
 //	void endDist(const OpSegment* seg, const OpSegment* opp);
-	std::vector<TGap> findGaps() const;
+	OpArray<TGap> findGaps() const;
 	int groupCount() const;
 	void initialEdgeRun(const OpEdge* edge, const OpSegment* oppSeg);
 	void markToDelete(float tStart, float tEnd);
@@ -103,8 +103,8 @@ struct CcCurves {
 	DUMP_DECLARATIONS
 #endif
 
-	std::vector<OpEdge*> c;
-	std::vector<EdgeRun> runs;
+	OpArray<OpEdge*> c;
+	OpSmallArray<EdgeRun, 8> runs;
 #if OP_DEBUG
 	std::vector<EdgeRun> debugRuns;  // runs that fit inside other runs
 #endif
@@ -187,7 +187,7 @@ struct OpCurveCurve {
 	OpSegment* opp;
 	CcCurves edgeCurves;
 	CcCurves oppCurves;
-	std::vector<FoundLimits> limits;
+	OpArray<FoundLimits> limits;
 	OpPtT snipEdge;
 	OpPtT snipOpp;
 	MatchReverse matchRev;
@@ -155,8 +155,11 @@ OpEdge::OpEdge(const OpEdge* edge, const OpPtT& s, const OpPtT& e
 OpEdge::OpEdge(const OpEdge* edge, float t1, float t2  OP_LINE_FILE_DEF(EdgeMaker maker))
 	: OpEdge() {
 	segment = edge->segment;
-	start = { segment->c.ptAtT(t1), t1 };
-	end = { segment->c.ptAtT(t2), t2 };
+	float ts[2] = { t1, t2 };
+	OpPoint pts[2];
+	segment->c.ptAtTs(ts, pts, 2);
+	start = { pts[0], t1 };
+	end = { pts[1], t2 };
 #if OP_DEBUG
 	debugMaker = maker;
 	debugSetMaker = { fileName, lineNo };
@@ -380,7 +383,7 @@ size_t OpEdge::countUnsortable() const {
 // or, re-walk the chain from this (where the find is now) to see if chain has been seen
 bool OpEdge::containsLink(const OpEdge* edge) const {
 	const OpEdge* chain = this;
-	std::vector<const OpEdge*> seen;
+	OpArray<const OpEdge*> seen;
 	for (;;) {
 		if (edge == chain)
 			return true;
@@ -441,7 +444,7 @@ bool OpEdge::isLinear() {
 	if (lineSet)
 		return isLine_impl;
 	lineSet = true;
-	return (isLine_impl = curve.isLinear());
+	return (isLine_impl = curve().isLinear());
 }
 
 void OpEdge::linkToEdge(FoundEdge& found, EdgeMatch match) {
@@ -485,16 +488,16 @@ bool OpEdge::linksTo(OpEdge* match) const {
 void OpEdge::markPals() {
 	OP_ASSERT(isUnsectable);
 	// edge is between one or more unsectableID ranges in intersections
-	std::vector<OpIntersection*> unsectables = segment->sects.unsectables(this);
+	OpArray<OpIntersection*> unsectables = segment->sects.unsectables(this);
 	OP_ASSERT(unsectables.size());
-	std::vector<EdgeDistance*> distPals;
+	OpArray<EdgeDistance*> distPals;
 	for (auto& dist : ray.distances) {
 		if (!dist.edge->isUnsectable)
 			continue;
 		if (this == dist.edge)
 			continue;
 		OpSegment* distSeg = dist.edge->segment;
-		std::vector<OpIntersection*> distUnsectables = distSeg->sects.unsectables(dist.edge);
+		OpArray<OpIntersection*> distUnsectables = distSeg->sects.unsectables(dist.edge);
 		if (OpIntersections::UnsectablesOverlap(unsectables, distUnsectables))
 			addPal(dist);
 	}
@@ -502,8 +505,8 @@ void OpEdge::markPals() {
 }
 
 // keep only one unsectable from any set of pals
-void OpEdge::matchUnsectable(EdgeMatch match, const std::vector<OpEdge*>& unsectInX,
-		std::vector<FoundEdge>& edges, AllowPals allowPals, AllowClose allowClose) {
+void OpEdge::matchUnsectable(EdgeMatch match, const OpArray<OpEdge*>& unsectInX,
+		OpArray<FoundEdge>& edges, AllowPals allowPals, AllowClose allowClose) {
 	const OpPoint firstPt = whichPtT(match).pt;
 	for (int index = 0; index < (int) unsectInX.size(); ++index) {
 		OpEdge* unsectable = unsectInX[index];
@@ -574,7 +577,7 @@ OpEdge* OpEdge::nextOut() {
 
 // !!! note that t value is 0 to 1 within edge (not normalized to segment t)
 NormalDirection OpEdge::normalDirection(Axis axis, float edgeInsideT) {
-	return curve.normalDirection(axis, edgeInsideT);
+	return curve().normalDirection(axis, edgeInsideT);
 }
 
 #if 0
@@ -669,6 +672,7 @@ void OpEdge::output(bool closed) {
 		firstEdge = nullptr;
 	} else
 		edge = this;
+	contours()->outputEdges.push_back(edge);
 	edge->outputLinkedList(firstEdge, true);
 }
 
@@ -676,8 +680,9 @@ void OpEdge::outputLinkedList(const OpEdge* firstEdge, bool first)
 {
 //	PathOpsV0Lib::PathOutput nativePath = contours()->callerOutput;
 	OP_DEBUG_CODE(debugOutPath = contours()->debugOutputID);
+	outputIndex = (int) contours()->outputEdges.size() - 1;
 	OpEdge* next = nextOut();
-	OpCurve copy = curve;
+	OpCurve copy = curve();
 	if (EdgeMatch::end == which())
 		copy.reverse();
 	copy.output(first, firstEdge == next);
@@ -755,7 +760,7 @@ void OpEdge::output(OpOutPath& path, bool closed) {
     do {
 		OP_DEBUG_CODE(edge->debugOutPath = path.debugID);
 		OpEdge* next = edge->nextOut();
-		OpCurve copy = edge->curve;
+		OpCurve copy = edge->curve();
 		if (EdgeMatch::end == edge->which())
 			copy.reverse();
 		if (!copy.output(path, first, firstEdge == next))
@@ -777,6 +782,11 @@ void OpEdge::setActive(bool state) {
 	active_impl = state;
 }
 
+void OpEdge::setCurve() const {
+	curve_impl = segment->c.subDivide(start, end);
+	curveSet = true;
+}
+
 const OpRect& OpEdge::closeBounds() {
 	// close bounds holds point bounds outset by 'close' fudge factor
 	if (linkBounds.isSet())
@@ -815,8 +825,8 @@ OpPtT OpEdge::ptTCloseTo(OpPtT oPtPair, const OpPtT& ptT) const {
 	
 #if 0
 void OpEdge::setCurveCenter() {
-	curve.pts[curve.pointCount()] = center.pt;
-	curve.centerPt = true;
+	curve_impl.pts[curve_impl.pointCount()] = center.pt;
+	curve_impl.centerPt = true;
 }
 #endif
 
@@ -911,7 +921,7 @@ const OpCurve& OpEdge::setVertical(const LinePts& pts) {
 	if (!upright_impl.pts[0].isFinite() ||  // !!! needed by CMake build; don't know why ...
 		upright_impl.pts[0] != pts.pts[0] || upright_impl.pts[1] != pts.pts[1]) {
 		upright_impl = pts;
-		vertical_impl = curve.toVertical(pts);
+		vertical_impl = curve().toVertical(pts);
 	}
 	return vertical_impl;
 }
@@ -922,9 +932,9 @@ void OpEdge::setWhich(EdgeMatch m) {
 
 // Remove duplicate pals that look at each other in found edges.
 // Remove pals equal to 'this' and edges this links to.
-void OpEdge::skipPals(EdgeMatch match, std::vector<FoundEdge>& edges) {
-	std::vector<FoundEdge> sectables;
-	std::vector<FoundEdge> unsectables;
+void OpEdge::skipPals(EdgeMatch match, OpArray<FoundEdge>& edges) {
+	OpArray<FoundEdge> sectables;
+	OpArray<FoundEdge> unsectables;
 	bool duplicates = false;
 	for (const auto& found : edges) {
 		if (found.edge->pals.size()) {
@@ -983,26 +993,33 @@ void OpEdge::skipPals(EdgeMatch match, std::vector<FoundEdge>& edges) {
 	std::swap(sectables, edges);
 }
 
+// if the edge curve is not built yet, subdivides the segment curve into local storage instead
 bool OpEdge::ctrlPtNearlyEnd() {
 #if OP_TEST_NEW_INTERFACE
 	// !!! call is linear instead?
-		return contours()->callBack(curve.c.type).controlNearlyEndFuncPtr(curve.c);
+	const OpCurve& segCurve = segment->c;
+	alignas(OpPoint) char local[sizeof(OpPoint) * 8];
+	if (curveSet || segCurve.c.size > sizeof(local))
+		return contours()->callBack(curve().c.type).controlNearlyEndFuncPtr(curve().c);
+	PathOpsV0Lib::Curve part { (PathOpsV0Lib::CurveData*) local, segCurve.c.size, segCurve.c.type };
+	memcpy(local, segCurve.c.data, segCurve.c.size);  // copies caller data past the points
+	contours()->callBack(part.type).subDivideFuncPtr(segCurve.c, start, end, part);
+	return contours()->callBack(part.type).controlNearlyEndFuncPtr(part);
 #else
-	for (int index = 1; index < segment->c.pointCount() - 1; ++index) {
-		if (!curve.pts[index].isNearly(start.pt) && !curve.pts[index].isNearly(end.pt))
+	for (int index = 1; index < segment->ptCount - 1; ++index) {
+		if (!curve().pts[index].isNearly(start.pt) && !curve().pts[index].isNearly(end.pt))
 			return false;
 	}
 	return true;
 #endif
 }
 
-// use already computed points stored in edge
+// use already computed points stored in edge; curve is built on first use
 void OpEdge::subDivide() {
 	id = segment->nextID();
-	curve = segment->c.subDivide(start, end);
 	setPointBounds();
 	calcCenterT();
-	if (segment->c.isLine() || OpMath::Equalish(ptBounds.left, ptBounds.right) 
+	if (segment->isLine || OpMath::Equalish(ptBounds.left, ptBounds.right) 
 			|| OpMath::Equalish(ptBounds.top, ptBounds.bottom) || ctrlPtNearlyEnd()) {
 		isLine_impl = true;
 		lineSet = true;
@@ -1078,3 +1095,12 @@ bool OpEdgeStorage::contains(OpIntersection* start, OpIntersection* end) const {
 		return false;
 	return next->contains(start, end);
 }
+
+// returns edge lists held in container storage before the edges are used again
+void OpEdgeStorage::reset() {
+	for (size_t index = 0; index < used; index++) {
+		storage[index].~OpEdge();
+		new (&storage[index]) OpEdge();
+	}
+	used = 0;
+}
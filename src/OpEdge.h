@@ -5,7 +5,6 @@
 #include "OpTightBounds.h"
 #include "OpOperators.h"
 #include "OpWinding.h"
-#include <vector>
 
 struct FoundEdge;
 struct OpContours;
@@ -152,7 +151,7 @@ struct SectRay {
 	DUMP_DECLARATIONS
 #endif
 
-	std::vector<EdgeDistance> distances;
+	OpArray<EdgeDistance> distances;
 	OpVector homeTangent;  // used to determine if unsectable edge is reversed
 	float normal;  // ray used to find windings on home edge (e.g., axis: h, center.y)
 	float homeCept;  // intersection of normal on home edge (e.g., axis: h, center.x)
@@ -197,7 +196,7 @@ struct OpHulls {
 	DUMP_DECLARATIONS
 #endif
 
-	std::vector<HullSect> h;
+	OpArray<HullSect> h;
 };
 
 enum class AllowPals {
@@ -291,11 +290,13 @@ private:
 		, winding(WindingUninitialized::dummy)
 		, sum(WindingUninitialized::dummy)
 		, many(WindingUninitialized::dummy)
+		, outputIndex(-1)
 		, whichEnd_impl(EdgeMatch::none)
 		, rayFail(EdgeFail::none)
 		, windZero(WindZero::unset)
 		, doSplit(EdgeSplit::no)
 		, closeSet(false)
+		, curveSet(false)
 //		, curvySet(false)
 		, lineSet(false)
 //		, verticalSet(false)
@@ -382,6 +383,10 @@ public:
 	OpContours* contours() const;
 	size_t countUnsortable() const;
 	bool ctrlPtNearlyEnd();
+	const OpCurve& curve() const {
+		if (!curveSet)
+			setCurve();
+		return curve_impl; }
 //	float curviness();
 	OpIntersection* findSect(EdgeMatch );
 	OpPtT findT(Axis , float oppXY) const;
@@ -400,8 +405,8 @@ public:
 //	void linkNextPrior(OpEdge* first, OpEdge* last);
 	bool linksTo(OpEdge* match) const;
 	void markPals();
-	void matchUnsectable(EdgeMatch , const std::vector<OpEdge*>& unsectInX, 
-			std::vector<FoundEdge>& , AllowPals , AllowClose );
+	void matchUnsectable(EdgeMatch , const OpArray<OpEdge*>& unsectInX, 
+			OpArray<FoundEdge>& , AllowPals , AllowClose );
 	OpEdge* nextOut();
 	NormalDirection normalDirection(Axis axis, float t);
 //	float oppDist() const;
@@ -417,7 +422,7 @@ public:
 	void reenable() {  // only used for coincidence
 		disabled = false; OP_DEBUG_CODE(debugZero = ZeroReason::uninitialized); }
 	void setActive(bool state);  // setter exists so debug breakpoints can be set
-//	const OpCurve& setCurve();  // copies start, end to points 0, last
+	void setCurve() const;  // subdivides segment curve from start to end
 //	void setCurveCenter();  // adds center point after curve points
 	void setDisabled(OP_DEBUG_CODE(ZeroReason reason));
 	void setDisabledZero(OP_DEBUG_CODE(ZeroReason reason)) {
@@ -441,7 +446,7 @@ public:
 #endif
 	const OpCurve& setVertical(const LinePts& );
 	void setWhich(EdgeMatch );  // setter exists so debug breakpoints can be set
-	void skipPals(EdgeMatch match, std::vector<FoundEdge>& edges);
+	void skipPals(EdgeMatch match, OpArray<FoundEdge>& edges);
 //	OpPtT splitPt(float oMidDist, OpPtT* result) const;
 	void subDivide();
 	CalcFail subIfDL(Axis axis, float t, OpWinding* );
@@ -494,7 +499,7 @@ public:
 	OpPtT start;
 	OpPtT center;  // curve location used to find winding contribution
 	OpPtT end;
-	OpCurve curve;
+	mutable OpCurve curve_impl;  // built from segment by curve() on first use
 	OpCurve vertical_impl;	// only access through set vertical function
 	LinePts upright_impl;   //  "
 	OpPointBounds ptBounds;
@@ -502,18 +507,20 @@ public:
 	OpWinding winding;	// contribution: always starts as 1, 0 (or 0, 1)
 	OpWinding sum;  // total incl. normal side of edge for operands (fill count in normal direction)
 	OpWinding many;  // temporary used by unsectables to contain all pal windings combined
-	std::vector<EdgeDistance> pals;	 // list of unsectable adjacent edges !!! should be pointers?
-	std::vector<OpEdge*> lessRay;  // edges found placed with smaller edge distance cept values
-	std::vector<OpEdge*> moreRay;  // edges found placed with larger edge distance cept values
+	OpArray<EdgeDistance> pals;	 // list of unsectable adjacent edges !!! should be pointers?
+	OpArray<OpEdge*> lessRay;  // edges found placed with smaller edge distance cept values
+	OpArray<OpEdge*> moreRay;  // edges found placed with larger edge distance cept values
 	OpHulls hulls;  // curve-curve intersections
 //	float curvy;  // rough ratio of midpoint line point line to length of end point line
 //	OpPtT oppEnd;  // pt and t for closest point on opposite curve from end point
 	int id;
+	int outputIndex;  // index of output contour containing edge; -1 if not output
 	EdgeMatch whichEnd_impl;  // if 'start', prior end equals start; if 'end' prior end matches end
 	EdgeFail rayFail;   // how computation (e.g., center) failed (on fail, windings are set to zero)
 	WindZero windZero;  // zero: edge normal points to zero side (the exterior of the loop)
 	EdgeSplit doSplit;  // used by curve/curve intersection to track subdivision
 	bool closeSet;
+	mutable bool curveSet;
 //	bool curvySet;
 	bool lineSet;
 //	bool verticalSet;
@@ -574,6 +581,7 @@ struct OpEdgeStorage {
 		, used(0) {
 	}
 	bool contains(OpIntersection* start, OpIntersection* end) const;
+	void reset();
 #if OP_DEBUG_DUMP
 	size_t debugCount() const;
 	std::string debugDump(std::string label, DebugLevel l, DebugBase b);
@@ -28,6 +28,8 @@ OpIntersection* OpIntersections::add(OpIntersection* sect) {
 }
 
 // this matches opp with nearby ptT
+// a scan, not a search in t: nearby points may have t values that are not nearby, and a
+// segment rarely has more than a few dozen intersections
 OpIntersection* OpIntersections::contains(const OpPtT& ptT, const OpSegment* opp) {
 	for (unsigned index = 0; index < i.size(); ++index) {
         OpIntersection* sect = i[index];
@@ -56,7 +58,7 @@ OpIntersection* const * OpIntersections::entry(const OpPtT& ptT, const OpSegment
 // for the unsectable / between code:
 //   if this set of intersections is reversed compared to the opposite, walk opposite backwards 
 void OpIntersections::makeEdges(OpSegment* segment) {
-    std::vector<const OpIntersection*> unsectables;
+    OpArray<const OpIntersection*> unsectables;
     OpIntersection* last = i.front();
     OP_ASSERT(!resort);
     for (auto sectPtr : i) {
@@ -111,19 +113,7 @@ void OpIntersections::markBetween() {
 }
 #endif
 
-const OpIntersection* OpIntersections::nearly(const OpPtT& ptT, OpSegment* oSeg) const {
-	for (unsigned index = 0; index < i.size(); ++index) {
-        OpIntersection* sect = i[index];
-        if (oSeg && (!sect->opp || sect->opp->segment != oSeg))
-            continue;
-		if (ptT.pt.isNearly(sect->ptT.pt) 
-                || (ptT.t - OpEpsilon <= sect->ptT.t && sect->ptT.t <= ptT.t + OpEpsilon))
-			return sect;
-	}
-	return nullptr;
-}
-
-void OpIntersections::range(const OpSegment* opp, std::vector<OpIntersection*>& result) {
+void OpIntersections::range(const OpSegment* opp, OpArray<OpIntersection*>& result) {
 	if (resort)
 	    sort();
     OP_DEBUG_CODE(float last = -1);
@@ -136,8 +126,8 @@ void OpIntersections::range(const OpSegment* opp, std::vector<OpIntersection*>&
     }
 }
 
-std::vector<OpIntersection*> OpIntersections::unsectables(const OpEdge* edge) {
-    std::vector<OpIntersection*> result;
+OpArray<OpIntersection*> OpIntersections::unsectables(const OpEdge* edge) {
+    OpArray<OpIntersection*> result;
     for (auto sect : i) {
         if (sect->ptT.t > edge->start.t)
             break;
@@ -153,8 +143,8 @@ std::vector<OpIntersection*> OpIntersections::unsectables(const OpEdge* edge) {
     return result;
 }
 
-bool OpIntersections::UnsectablesOverlap(std::vector<OpIntersection*> set1,
-        std::vector<OpIntersection*> set2) {
+bool OpIntersections::UnsectablesOverlap(OpArray<OpIntersection*> set1,
+        OpArray<OpIntersection*> set2) {
     for (OpIntersection* i1: set1) {
         for (OpIntersection* i2 : set2) {
             if (i1->unsectID == i2->unsectID)
@@ -179,7 +169,7 @@ struct SectPreferred {
 
     bool find(OpIntersection* );
 
-    std::vector<OpSegment*> visited;
+    OpArray<OpSegment*> visited;
     OpPoint best;
     bool bestOnEnd;
 };
@@ -315,7 +305,7 @@ void OpIntersections::sort() {
     size_t rangeStart = 0;
     auto processRange = [this, &rangeStart](size_t rangeEnd) {
         size_t toFind = rangeEnd - rangeStart;
-        std::vector<OpIntersection*> sorted(toFind);  // reserve sorted pointers copy (zeroed)
+        OpArray<OpIntersection*> sorted(toFind);  // reserve sorted pointers copy (zeroed)
         size_t endI = rangeEnd;
         size_t found = 0;
         while (found < toFind && endI < i.size()) {  // look for ends that match found starts
@@ -353,10 +343,10 @@ void OpIntersections::sort() {
     } while (++index < i.size());
 }
 
-void OpIntersections::windCoincidences(std::vector<OpEdge>& edges  
+void OpIntersections::windCoincidences(OpArray<OpEdge>& edges  
         OP_DEBUG_PARAMS(OpVector tangent)) {
     sort();
-    std::vector<CoinPair> pairs;
+    OpArray<CoinPair> pairs;
     OpEdge* edge = &edges.front();
     for (auto sectPtr : i) {
         int coinID = sectPtr->coincidenceID;
@@ -149,15 +149,14 @@ struct OpIntersections {
     OpIntersection* contains(const OpPtT& ptT, const OpSegment* opp);  // nearby ptT
     OpIntersection* const * entry(const OpPtT& , const OpSegment* opp) const;  // exact opp + ptT
 	void makeEdges(OpSegment* );
-	const OpIntersection* nearly(const OpPtT& ptT, OpSegment* oSeg) const;  // near match of pt or t
-    void range(const OpSegment* , std::vector<OpIntersection*>& );
+    void range(const OpSegment* , OpArray<OpIntersection*>& );
 	void sort();  // 
     void mergeNear();
 	// return intersections that delineate unsectable runs that contain this edge
-	std::vector<OpIntersection*> unsectables(const OpEdge* );
-	static bool UnsectablesOverlap(std::vector<OpIntersection*> set1,
-			std::vector<OpIntersection*> set2);
-	void windCoincidences(std::vector<OpEdge>& edges  OP_DEBUG_PARAMS(OpVector tangent));
+	OpArray<OpIntersection*> unsectables(const OpEdge* );
+	static bool UnsectablesOverlap(OpArray<OpIntersection*> set1,
+			OpArray<OpIntersection*> set2);
+	void windCoincidences(OpArray<OpEdge>& edges  OP_DEBUG_PARAMS(OpVector tangent));
 #if OP_DEBUG
     OpIntersection* debugAlreadyContains(const OpPoint& , const OpSegment* opp) const;
     bool debugContains(const OpPtT& , const OpSegment* opp) const;  // check for duplicates
@@ -167,7 +166,7 @@ struct OpIntersections {
 #endif
 
 	// all intersections are stored here before edges are rewritten
-    std::vector<OpIntersection*> i;
+    OpSmallArray<OpIntersection*, 4> i;
     bool resort;
 };
 
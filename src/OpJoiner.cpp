@@ -45,6 +45,10 @@ void OpLimb::add(OpTree& tree, OpEdge* test, EdgeMatch m, LimbType limbType, siz
 	if (childBounds.perimeter() > tree.bestPerimeter)
 		return;
 	OpContours& contours = *tree.contour.contours;
+	if (contours.limits.maxLimbs && tree.totalUsed >= contours.limits.maxLimbs) {
+		contours.setError(PathOpsV0Lib::ContextError::limbLimit);
+		return;
+	}
 	OpLimb* branch = contours.allocateLimb(&tree);
 	branch->set(tree, test, this, m, limbType, limbIndex, otherEnd, &childBounds);
 #if OP_DEBUG
@@ -94,7 +98,7 @@ void OpLimb::foreach(OpJoiner& join, OpTree& tree, LimbType limbType) {
 	}
 	if (LimbType::linked == limbType)
 		return;
-	for (const std::vector<OpEdge*>& edges : { join.unsectByArea, join.unsortables } ) {
+	for (const OpArray<OpEdge*>& edges : { join.unsectByArea, join.unsortables } ) {
 		for (OpEdge* test : edges) {
 			if (test->inLinkups)
 				continue;
@@ -201,7 +205,7 @@ void OpTree::initialize(OpJoiner& join, LimbType limbType) {
 		case LimbType::linked:
 			break;
 		case LimbType::unlinked: 
-			for (const std::vector<OpEdge*>& edges : { join.unsectByArea, join.unsortables } )
+			for (const OpArray<OpEdge*>& edges : { join.unsectByArea, join.unsortables } )
 				for (OpEdge* test : edges)
 					join.unlink(test);
 			break;
@@ -237,7 +241,7 @@ OpLimb& OpTree::limb(int index) {
 
 // join best limb to edge start, then parent to best limb, until lastEdge is found
 bool OpTree::join(OpJoiner& join) {
-	std::vector<uint32_t> linkupsErasures;
+	OpArray<uint32_t> linkupsErasures;
 	const OpLimb* bestL = bestLimb;
 	OpEdge* best = bestL->edge;
 	if (EdgeMatch::end == bestL->match) {	
@@ -312,26 +316,25 @@ OpLimb& OpLimbStorage::limb(OpTree& tree, int index) {
 	return block->storage[index];
 }
 
+// blocks linked by next block are freed by the caller first
 void OpLimbStorage::reset() {
 	used = 0;
-	while (nextBlock) {
-        OpLimbStorage* save = nextBlock->nextBlock;
-        delete nextBlock;
-        nextBlock = save;
-	}
 	nextBlock = nullptr;
 }
 
 #if OP_TEST_NEW_INTERFACE
-OpJoiner::OpJoiner(OpContours& contours)
+OpJoiner::OpJoiner(OpContours& c)
 	:
 #else
-OpJoiner::OpJoiner(OpContours& contours, OpOutPath& p)
+OpJoiner::OpJoiner(OpContours& c, OpOutPath& p)
 	: path(p)
 	,
 #endif
-	  linkMatch(EdgeMatch::none)
+	  contours(c)
+	, linkMatch(EdgeMatch::none)
 	, linkPass(LinkPass::none)
+	, assemblePass(LinkPass::normal)
+	, linkIndex(0)
 	, edge(nullptr)
 	, lastLink(nullptr)
 	, disabledBuilt(false)
@@ -466,7 +469,7 @@ struct LoopCheck {
 // !!! TODO : find direction of loop at add 'reverse' param to output if needed
 //     direction should consider whether edge normal points to inside or outside
 bool OpJoiner::detachIfLoop(OpEdge* e, EdgeMatch loopMatch) {
-	std::vector<LoopCheck> edges;
+	OpArray<LoopCheck> edges;
 	OpEdge* test = e;
 	// walk forwards to end, keeping one point per edge
 	OP_ASSERT(e && !e->debugIsLoop());
@@ -565,19 +568,41 @@ bool OpJoiner::detachIfLoop(OpEdge* e, EdgeMatch loopMatch) {
 // the scale of the big things to see if the small remaining things can be ignored
 // first, figure out why the current test fails
 
-bool OpJoiner::linkRemaining(OP_DEBUG_CODE(OpContours* debugContours)) {
+// link unambiguous edges, then remaining edges; if that fails, try again including unsectables
+FoundLinks OpJoiner::linkPasses(size_t& budget) {
+	for (;;) {
+		if (LinkPass::remaining != linkPass && !linkUnambiguous(assemblePass, budget))
+			return FoundLinks::paused;
+		FoundLinks found = linkRemaining(budget);
+		if (FoundLinks::fail != found)
+			return found;
+		if (LinkPass::unsectable == assemblePass 
+				|| PathOpsV0Lib::ContextError::none != contours.error)
+			return FoundLinks::fail;
+		assemblePass = LinkPass::unsectable;
+		linkPass = LinkPass::none;
+		linkIndex = 0;
+	}
+}
+
+// each pass through link ups uses one unit of budget; returns paused if budget runs out
+FoundLinks OpJoiner::linkRemaining(size_t& budget) {
 	OP_DEBUG_CONTEXT();
+	if (LinkPass::remaining != linkPass) {
 #if OP_DEBUG_IMAGE
-	debugImage();
+		debugImage();
 #endif
-    OP_DEBUG_CODE(debugMatchRay(debugContours));
-	linkPass = LinkPass::remaining;
-	// match links may add or remove from link ups. Iterate as long as link ups is not empty
-	for (auto e : linkups.l) {
-		e->setLinkBounds();
+		OP_DEBUG_CODE(debugMatchRay(&contours));
+		linkPass = LinkPass::remaining;
+		// match links may add or remove from link ups. Iterate as long as link ups is not empty
+		for (auto e : linkups.l) {
+			e->setLinkBounds();
+		}
 	}
 	OP_DEBUG_IMAGE_CODE(int debugLoopCounter = 0);
     while (linkups.l.size()) {
+		if (contours.stopStep(budget))
+			return FoundLinks::paused;
 		// sort to process largest first
 		// !!! could optimize to avoid search, but for now, this is the simplest
 		linkups.sort();
@@ -587,11 +612,11 @@ bool OpJoiner::linkRemaining(OP_DEBUG_CODE(OpContours* debugContours)) {
 				break;
 			linkups.l.pop_back();
 			if (!linkups.l.size())
-				return true;
+				return FoundLinks::yes;
 		}
 		OP_DEBUG_VALIDATE_CODE(debugValidate());
         if (!matchLinks(true))
-			return false;
+			return FoundLinks::fail;
 #if 0 && OP_DEBUG_IMAGE
 		colorOut(orange);
 #endif
@@ -603,17 +628,21 @@ bool OpJoiner::linkRemaining(OP_DEBUG_CODE(OpContours* debugContours)) {
 		OP_DEBUG_VALIDATE_CODE(debugValidate());
 		OP_DEBUG_IMAGE_CODE(if (++debugLoopCounter < 0) OpDebugOut(""));  // allows seeing loop iteration that failed
     }
-	return true;
+	return FoundLinks::yes;
 }
 
-void OpJoiner::linkUnambiguous(LinkPass lp) {
+// each edge uses one unit of budget; returns false if budget runs out before all edges are seen
+bool OpJoiner::linkUnambiguous(LinkPass lp, size_t& budget) {
 	OP_DEBUG_CONTEXT();
     OP_DEBUG_VALIDATE_CODE(debugValidate());
     // match up edges that have only a single possible prior or next link, and add them to new list
 	linkPass = lp;
 	OP_DEBUG_VALIDATE_CODE(debugValidate());
-	std::vector<OpEdge*>& edges = LinkPass::normal == lp ? byArea : unsectByArea;
-    for (auto& e : edges) {
+	OpArray<OpEdge*>& edges = LinkPass::normal == lp ? byArea : unsectByArea;
+    for (; linkIndex < edges.size(); ++linkIndex) {
+		if (contours.stopStep(budget))
+			return false;
+		OpEdge* e = edges[linkIndex];
 		if (e->disabled)
             continue;   // likely marked as part of a loop below
         if (!e->isActive())  // check if already saved in linkups
@@ -630,6 +659,7 @@ void OpJoiner::linkUnambiguous(LinkPass lp) {
 		(void) linkUp(e->setLastEdge());
 		OP_DEBUG_VALIDATE_CODE(debugValidate());
     }
+	return true;
 }
 
 /* relationship between prev/this/next and whichEnd: (start, end)
@@ -646,7 +676,7 @@ void OpJoiner::linkUnambiguous(LinkPass lp) {
 // first pass: only allow unambiguous connections; only one choice, matching zero side, etc.
 // second pass: check for unambiuous, then allow reversing, pick smallest area, etc.
 bool OpJoiner::linkUp(OpEdge* e) {
-	std::vector<FoundEdge> edges;
+	OpArray<FoundEdge> edges;
 	OP_ASSERT(!e->debugIsLoop(EdgeMatch::end, LeadingLoop::will));
 	const OpSegment* segment = e->segment;
 	bool hadLinkTo = false;
@@ -694,6 +724,8 @@ bool OpJoiner::matchLinks(bool popLast) {
 	found.clear();
 	matchPt = lastLink->whichPtT(EdgeMatch::end).pt;
 	OpTree tree(*this);
+	if (PathOpsV0Lib::ContextError::none != contours.error)
+		return false;  // too many limbs
 #if 0 && OP_DEBUG_VERBOSE
 	std::string s = "perimeter:" + STR(tree.bestPerimeter);
 	s += " edges:";
@@ -733,7 +765,7 @@ bool OpJoiner::matchLinks(bool popLast) {
 bool OpJoiner::relinkUnambiguous(size_t link) {
 	if (link >= linkups.l.size())
 		return false;
-	std::vector<size_t> linkupsErasures;
+	OpArray<size_t> linkupsErasures;
 	bool startIsBestMatch = true;
 	size_t tIndex = 0;
 	edge = linkups.l[link];
@@ -741,7 +773,7 @@ bool OpJoiner::relinkUnambiguous(size_t link) {
 		EdgeMatch tMatch;
 		auto scanForMatch = [&tMatch, &tIndex, link, this](OpEdge* eEdge, EdgeMatch eMatch) {
 			OpPoint edgePt = eEdge->whichPtT(eMatch).pt;
-			for (const std::vector<OpEdge*>& edges : { unsectByArea, unsortables } ) {
+			for (const OpArray<OpEdge*>& edges : { unsectByArea, unsortables } ) {
 				auto testUnmatch = [edgePt](OpEdge* test, EdgeMatch match) {
 					return test->whichPtT(match).pt == edgePt;
 				};
@@ -14,6 +14,12 @@ enum class LinkPass {
 	remaining,
 };
 
+enum class FoundLinks {
+	fail,
+	paused,  // budget ran out; call again to resume
+	yes
+};
+
 /* !!! consider a rewrite where a single link up is
     struct LinkUp {
 		OpPointBounds bounds;
@@ -28,7 +34,7 @@ struct LinkUps {
 	DUMP_DECLARATIONS
 #endif
 
-	std::vector<OpEdge*> l;
+	OpArray<OpEdge*> l;
 };
 
 struct OpJoiner {
@@ -37,14 +43,15 @@ struct OpJoiner {
 #else
 	OpJoiner(OpContours& contours, OpOutPath& );
 #endif
-//	bool activeUnsectable(const OpEdge* , EdgeMatch , std::vector<FoundEdge>& oppEdges);
+//	bool activeUnsectable(const OpEdge* , EdgeMatch , OpArray<FoundEdge>& oppEdges);
 	void addEdge(OpEdge* );
 	void addToLinkups(OpEdge* );
 	void buildDisabled(OpContours& );
 	void buildDisabledPals(OpContours& );
 	bool detachIfLoop(OpEdge* , EdgeMatch loopEnd);
-	bool linkRemaining(OP_DEBUG_CODE(OpContours*));
-	void linkUnambiguous(LinkPass );
+	FoundLinks linkPasses(size_t& budget);
+	FoundLinks linkRemaining(size_t& budget);
+	bool linkUnambiguous(LinkPass , size_t& budget);
 	bool linkUp(OpEdge* );
 	bool matchLinks(bool popLast);
 	bool relinkUnambiguous(size_t checked);
@@ -67,16 +74,19 @@ struct OpJoiner {
 #if !OP_TEST_NEW_INTERFACE
 	OpOutPath& path;	// !!! move op joiner into op contours to eliminate reference?
 #endif
-	std::vector<OpEdge*> byArea;
-	std::vector<OpEdge*> unsectByArea;
-	std::vector<OpEdge*> disabled;
-	std::vector<OpEdge*> disabledPals;
-    std::vector<OpEdge*> unsortables;
-	std::vector<FoundEdge> found;  //edges, real or constructed, with an end equal to matchPt 
+	OpContours& contours;
+	OpArray<OpEdge*> byArea;
+	OpArray<OpEdge*> unsectByArea;
+	OpArray<OpEdge*> disabled;
+	OpArray<OpEdge*> disabledPals;
+    OpArray<OpEdge*> unsortables;
+	OpArray<FoundEdge> found;  //edges, real or constructed, with an end equal to matchPt 
     FoundEdge bestGap;
 	LinkUps linkups;  // vector wrapper (allows data specific debugging / dumping)
 	EdgeMatch linkMatch;
 	LinkPass linkPass;
+	LinkPass assemblePass;  // normal or unsectable; kept so link passes can resume
+	size_t linkIndex;  // next edge for link unambiguous
 	OpEdge* edge;  // start of current link list
 	OpEdge* lastLink;  // end of current link list
 	OpPoint matchPt;
@@ -56,85 +56,6 @@ void OpRoots::prioritize01() {
         std::swap(roots[1], roots[count - 1]);  // zero in front, move 1 to second position
 }
 
-OpVector OpVector::normalize() {
-    float len = length();
-    if (!OpMath::IsFinite(len))
-        return { 0, 0 };
-    if (!len)
-        return { OpNaN, OpNaN };
-    float inverseLength = 1 / len;
-    dx *= inverseLength;
-    dy *= inverseLength;
-    return *this;
-}
-
-bool OpVector::isFinite() const {
-    return OpMath::IsFinite(dx) && OpMath::IsFinite(dy);
-}
-
-// Use the axis with the greatest change to decide if mid is between start and end.
-// While this doesn't work in general, the callers are dealing with coincident curves
-// which may be close, but not on top of each other. When they are axis-aligned, the
-// larger provides a better metric of whether multiple curves overlap.
-bool OpPoint::Between(OpPoint start, OpPoint mid, OpPoint end) {
-    OpVector scope = end - start;
-    XyChoice xy = scope.larger();
-    return OpMath::Between(start.choice(xy), mid.choice(xy), end.choice(xy));
-}
-
-bool OpPoint::isFinite() const {
-#if OP_DEBUG
-    if (OpMath::IsNaN(x)) {
-        int32_t xBits = OpDebugFloatToBits(x);
-        OP_ASSERT(!(xBits & 1));
-    }
-    if (OpMath::IsNaN(y)) {
-        int32_t yBits = OpDebugFloatToBits(y);
-        OP_ASSERT(!(yBits & 1));
-    }
-#endif
-    // return *this * 0 == OpPoint(0, 0);  // does not work with MSVC and /fp:fast
-    return OpMath::IsFinite(x) && OpMath::IsFinite(y);
-}
-
-bool OpPoint::isNearly(OpPoint test) const {
-    return OpMath::Equalish(x, test.x) && OpMath::Equalish(y, test.y);
-}
-
-void OpPoint::pin(const OpPoint a, const OpPoint b) {
-    x = OpMath::PinUnsorted(a.x, x, b.x);
-    y = OpMath::PinUnsorted(a.y, y, b.y);
-}
-
-void OpPoint::pin(const OpRect& r) {
-    x = OpMath::PinSorted(r.left, x, r.right);
-    y = OpMath::PinSorted(r.top, y, r.bottom);
-}
-
-bool OpPoint::soClose(OpPoint test) const {
-    return OpMath::Between(OpMath::CloseSmaller(x), test.x, OpMath::CloseLarger(x))
-        && OpMath::Between(OpMath::CloseSmaller(y), test.y, OpMath::CloseLarger(y));
-}
-
-OpPoint OpRect::center() const { 
-    return { OpMath::Average(left, right), OpMath::Average(top, bottom) }; 
-}
-
-bool OpRect::isFinite() const {
-    return OpMath::IsFinite(left) && OpMath::IsFinite(top)
-        && OpMath::IsFinite(right) && OpMath::IsFinite(bottom);
-}
-
-OpRect OpRect::outsetClose() const {
-    OpRect result = { OpMath::CloseSmaller(left), OpMath::CloseSmaller(top),
-	        OpMath::CloseLarger(right), OpMath::CloseLarger(bottom) };
-    return result;
-}
-
-bool OpPtT::isNearly(const OpPtT& o) const {
-    return pt.isNearly(o.pt) || OpMath::NearlyEqualT(t, o.t);
-}
-
 float OpMath::CloseLarger(float a) {
     float next = NextLarger(a);
     return fmaf(next - a, OpCloseFactor, a); 
@@ -273,6 +194,168 @@ OpRoots OpMath::CubicRootsReal(OpCubicFloatType A, OpCubicFloatType B,
     return roots;
 }
 
+thread_local OpRootCounts OpMath::RootCounts = { 0, 0 };
+
+// Roots found in float are kept only if they can be shown to be close to the double ones.
+// The discriminant must be farther from zero than its worst case rounding error, so that the
+// number of roots is right. Each root from zero to one must also be within RootTolerance of a
+// true root: the polynomial's value there, plus the rounding error in computing it, divided by
+// the slope, bounds the distance to the root. Callers discard roots outside zero to one, after
+// pinning those within epsilon of either; a root certainly farther out needs no more accuracy.
+// Otherwise, the polynomial is solved again in double.
+// (The example in the #if 0 block above fails the discriminant test: Q3 and R2 are too close.)
+constexpr float RootDiscriminantError = 4 * OpEpsilon;
+constexpr float RootCoefficientError = 8 * OpEpsilon;  // for values computed from a, b, c
+constexpr float RootTolerance = 8 * OpEpsilon;
+
+// Evaluates the polynomial at r with Horner's rule, and returns a bound on its rounding error.
+// The running bound (Higham, Accuracy and Stability of Numerical Algorithms, algorithm 5.1)
+// follows the partial values actually computed, so it is far smaller than an a priori bound
+// from the coefficient magnitudes.
+template <size_t count>
+static float hornerError(const float (&coeffs)[count], float r, float& value) {
+    float absR = fabsf(r);
+    value = coeffs[0];
+    float mu = fabsf(value) / 2;
+    for (size_t index = 1; index < count; ++index) {
+        value = value * r + coeffs[index];
+        mu = mu * absR + fabsf(value);
+    }
+    return OpEpsilon * (2 * mu - fabsf(value));  // twice the unit roundoff, for safety
+}
+
+// error bounds the distance from r to a root, times the slope at r
+static bool rootCertified(float r, float value, float slope, float error) {
+    error += fabsf(value);
+    float absSlope = fabsf(slope);
+    if (error < (-OpEpsilon - r) * absSlope || error < (r - 1 - OpEpsilon) * absSlope)
+        return true;
+    return error <= RootTolerance * absSlope  // also rejects NaN
+            && error < fabsf(r) * absSlope && error < fabsf(r - 1) * absSlope;
+}
+
+// one Newton step first leaves the root as close as float evaluation allows
+static bool quadRootCertified(float A, float B, float C, float& r) {
+    const float coeffs[] { A, B, C };
+    float value;
+    hornerError(coeffs, r, value);
+    float step = value / (2 * A * r + B);
+    if (OpMath::IsFinite(step))
+        r -= step;
+    float error = hornerError(coeffs, r, value);
+    return rootCertified(r, value, 2 * A * r + B, error);
+}
+
+// returns false if the number of roots or their values can't be certified
+static bool quadRootsFloat(float A, float B, float C, OpRoots& roots) {
+    if (0 == A) {
+        if (0 == B)
+            roots = 0 == C ? OpRoots() : OpRoots(0.f);
+        else
+            roots = OpRoots(-C / B);
+        return true;
+    }
+    float p = B / (2 * A);
+    float q = C / A;
+    float p2 = p * p;
+    float disc = p2 - q;
+    if (!(fabsf(disc) > RootDiscriminantError * (p2 + fabsf(q))))  // also rejects NaN
+        return false;
+    if (disc < 0) {
+        roots = OpRoots();
+        return true;
+    }
+    // compute the larger root first, and the smaller from their product, to avoid cancellation
+    // roots are returned in the same order as QuadRootsDouble: (sqrt - p, -sqrt - p)
+    float sqrtDisc = sqrtf(disc);
+    float larger = p < 0 ? sqrtDisc - p : -sqrtDisc - p;
+    float smaller = q / larger;
+    if (!quadRootCertified(A, B, C, larger) || !quadRootCertified(A, B, C, smaller))
+        return false;
+    roots = p < 0 ? OpRoots(larger, smaller) : OpRoots(smaller, larger);
+    return true;
+}
+
+// the coefficients were rounded from double to float, which adds half an epsilon of each term
+static bool cubicRootCertified(float A, float B, float C, float D, float& r) {
+    const float coeffs[] { A, B, C, D };
+    float value;
+    hornerError(coeffs, r, value);
+    float step = value / ((3 * A * r + 2 * B) * r + C);
+    if (OpMath::IsFinite(step))
+        r -= step;
+    float error = hornerError(coeffs, r, value);
+    float absR = fabsf(r);
+    error += OpEpsilon / 2 * (((fabsf(A) * absR + fabsf(B)) * absR + fabsf(C)) * absR + fabsf(D));
+    return rootCertified(r, value, (3 * A * r + 2 * B) * r + C, error);
+}
+
+// same as the general case of CubicRootsReal, in float
+static bool cubicRootsFloat(float A, float B, float C, float D, OpRoots& roots) {
+    float invA = 1 / A;
+    float a = B * invA;
+    float b = C * invA;
+    float c = D * invA;
+    float a2 = a * a;
+    float Q = (a2 - b * 3) / 9;
+    float R = (2 * a2 * a - 9 * a * b + 27 * c) / 54;
+    float R2 = R * R;
+    float Q3 = Q * Q * Q;
+    float R2MinusQ3 = R2 - Q3;
+    // first order error in R2 - Q3, from the errors in R and Q
+    float errR = RootCoefficientError * (2 * fabsf(a2 * a) + 9 * fabsf(a * b) + 27 * fabsf(c)) / 54;
+    float errQ = RootCoefficientError * (a2 + 3 * fabsf(b)) / 9;
+    float errDisc = 2 * fabsf(R) * errR + 3 * Q * Q * errQ
+            + RootDiscriminantError * (R2 + fabsf(Q3));
+    if (!(fabsf(R2MinusQ3) > errDisc))
+        return false;
+    float adiv3 = a / 3;
+    roots = OpRoots();
+    if (R2MinusQ3 < 0) {   // we have 3 real roots
+        float theta = acosf(std::max(std::min(1.f, R / sqrtf(Q3)), -1.f));
+        float neg2RootQ = -2 * sqrtf(Q);
+        roots.add(neg2RootQ * cosf(theta / 3) - adiv3);
+        roots.addEnd(neg2RootQ * cosf((theta + 2 * OpPI) / 3) - adiv3);
+        roots.addEnd(neg2RootQ * cosf((theta - 2 * OpPI) / 3) - adiv3);
+    } else {  // we have 1 real root; R2 == Q3 is rejected above
+        float root = cbrtf(fabsf(R) + sqrtf(R2MinusQ3));
+        if (R > 0)
+            root = -root;
+        if (root != 0)
+            root += Q / root;
+        roots.add(root - adiv3);
+    }
+    for (unsigned index = 0; index < roots.count; ++index) {
+        if (!cubicRootCertified(A, B, C, D, roots.roots[index]))
+            return false;
+    }
+    return true;
+}
+
+// cubics with a known root at zero or one, or no cubic term, are solved as quadratics
+OpRoots OpMath::CubicRoots(OpCubicFloatType A, OpCubicFloatType B,
+        OpCubicFloatType C, OpCubicFloatType D, MatchEnds common) {
+    if (0 == A || MatchEnds::none != common || 0 == D || 0 == A + B + C + D)
+        return CubicRootsReal(A, B, C, D, common);
+    OpRoots roots;
+    if (cubicRootsFloat((float) A, (float) B, (float) C, (float) D, roots)) {
+        ++RootCounts.floatPath;
+        return roots;
+    }
+    ++RootCounts.doublePath;
+    return CubicRootsReal(A, B, C, D, common);
+}
+
+OpRoots OpMath::QuadRoots(float A, float B, float C) {
+    OpRoots roots;
+    if (quadRootsFloat(A, B, C, roots)) {
+        ++RootCounts.floatPath;
+        return roots;
+    }
+    ++RootCounts.doublePath;
+    return QuadRootsDouble(A, B, C);
+}
+
 // min, max not necessarily sorted (between works regardless)
 float OpMath::PinUnsorted(float min, float value, float max) {
     if (Between(min, value, max))
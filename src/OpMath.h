@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <type_traits>
 
 #ifndef _WIN32
 #include <math.h>
@@ -24,6 +25,7 @@ constexpr auto OpCloseFactor = 10.f;  // !!! picked out of the air 8 too small f
 #include "OpDebugDouble.h"
 #include "OpDebugDump.h"
 #include "OpDebugImage.h"
+#include "OpSimd.h"
 
 // !!! move to OpTypes.h one day
 template <typename T, size_t N> char (&ArrayCountHelper(T (&array)[N]))[N];
@@ -173,8 +175,12 @@ struct OpRoots {
 const float OpDebugNaN = std::numeric_limits<float>::signaling_NaN(); // std::nanf("1");
 #endif
 
-struct OpPoint;
-struct OpRect;
+// geometry is templated on its scalar; the engine uses float, and double where float
+// computations lose too much precision
+template <typename T> struct OpPointOf;
+template <typename T> struct OpRectOf;
+typedef OpPointOf<float> OpPoint;
+typedef OpRectOf<float> OpRect;
 
 enum class XyChoice : uint8_t {
     inX,
@@ -222,106 +228,113 @@ inline XyChoice toXyChoice(Axis a) {
     return static_cast<XyChoice>(a);
 }
 
-struct OpVector {
-    OpVector()
+template <typename T>
+struct OpVectorOf {
+    OpVectorOf()
         : dx(OpNaN)
         , dy(OpNaN) {
     }
 
-    OpVector(OpPoint );
+    OpVectorOf(OpPointOf<T> );
 
-    OpVector(float x, float y) {
+    OpVectorOf(T x, T y) {
         dx = x;
         dy = y;
     }
 
-    friend bool operator==(OpVector a, OpVector b) {
+    template <typename U>
+    explicit OpVectorOf(OpVectorOf<U> v)
+        : dx((T) v.dx)
+        , dy((T) v.dy) {
+    }
+
+    friend bool operator==(OpVectorOf a, OpVectorOf b) {
         return a.dx == b.dx && a.dy == b.dy;
     }
 
-    OpVector operator-() const {
+    OpVectorOf operator-() const {
         return { -dx, -dy };
     }
 
-    void operator+=(OpVector v) {
+    void operator+=(OpVectorOf v) {
         dx += v.dx;
         dy += v.dy;
     }
 
-    void operator-=(OpVector v) {
+    void operator-=(OpVectorOf v) {
         dx -= v.dx;
         dy -= v.dy;
     }
 
-    void operator/=(float s) {
+    void operator/=(T s) {
         dx /= s;
         dy /= s;
     }
 
-    void operator/=(OpVector v) {
+    void operator/=(OpVectorOf v) {
         dx /= v.dx;
         dy /= v.dy;
     }
 
-    void operator*=(float s) {
+    void operator*=(T s) {
         dx *= s;
         dy *= s;
     }
 
-    OpVector operator+(OpVector v) {
-        OpVector result = *this;
+    OpVectorOf operator+(OpVectorOf v) {
+        OpVectorOf result = *this;
         result += v;
         return result;
     }
 
-    OpVector operator-(OpVector v) {
-        OpVector result = *this;
+    OpVectorOf operator-(OpVectorOf v) {
+        OpVectorOf result = *this;
         result -= v;
         return result;
     }
 
-    OpVector operator*(float s) {
-        OpVector result = *this;
+    OpVectorOf operator*(T s) {
+        OpVectorOf result = *this;
         result *= s;
         return result;
     }
 
-    friend OpVector operator*(float a, const OpVector& b) {  // must be const ref to disambiguate
+    friend OpVectorOf operator*(T a, const OpVectorOf& b) {  // must be const ref to disambiguate
         return { a * b.dx, a * b.dy };
     }
 
-    OpVector operator/(float s) {
-        OpVector result = *this;
+    OpVectorOf operator/(T s) {
+        OpVectorOf result = *this;
         result /= s;
         return result;
     }
 
-    OpVector operator/(OpVector v) {
-        OpVector result = *this;
+    OpVectorOf operator/(OpVectorOf v) {
+        OpVectorOf result = *this;
         result /= v;
         return result;
     }
 
-    float dot(OpVector a) const {
+    T dot(OpVectorOf a) const {
         return dx * a.dx + dy * a.dy;
     }
 
-    float cross(OpVector a) const {
+    T cross(OpVectorOf a) const {
 #if 01
-        float dxy = dx * a.dy;
-        float dyx = dy * a.dx;
+        T dxy = dx * a.dy;
+        T dyx = dy * a.dx;
         return dxy - dyx;
 #else
         return dx * a.dy - dy * a.dx;
 #endif
     }
 
-    float choice(XyChoice xyChoice) const {
+    T choice(XyChoice xyChoice) const {
         OP_ASSERT(XyChoice::inZ != xyChoice);
         return *(&dx + +xyChoice);
     }
 
-    float& choice(XyChoice xyChoice) {
+    T& choice(XyChoice xyChoice) {
         OP_ASSERT(XyChoice::inZ != xyChoice);
         return *(&dx + +xyChoice);
     }
@@ -329,35 +342,38 @@ struct OpVector {
     bool isFinite() const;
 
     XyChoice larger() const {
-        return fabsf(dx) > fabsf(dy) ? XyChoice::inX : XyChoice::inY;
+        return std::fabs(dx) > std::fabs(dy) ? XyChoice::inX : XyChoice::inY;
     }
 
-    float length() const {
-        return sqrtf(lengthSquared());
+    T length() const {
+        return std::sqrt(lengthSquared());
     }
 
-    float lengthSquared() const {
+    T lengthSquared() const {
         return dx * dx + dy * dy;
     }
 
-    OpVector normalize();
-    OpVector setLength(float len) {
-        float base = length(); return OpVector(dx * len / base, dy * len / base); }
+    OpVectorOf normalize();
+    OpVectorOf setLength(T len) {
+        T base = length(); return OpVectorOf(dx * len / base, dy * len / base); }
 
 #if OP_DEBUG_DUMP
     DUMP_DECLARATIONS
 #endif
 
-    float dx;
-    float dy;
+    T dx;
+    T dy;
 };
 
+typedef OpVectorOf<float> OpVector;
+
 enum class SetToNaN {
     dummy
 };
 
-struct OpPoint {
-    OpPoint() 
+template <typename T>
+struct OpPointOf {
+    OpPointOf() 
 #if OP_DEBUG
         : x(OpDebugNaN)
         , y(OpDebugNaN) 
@@ -365,147 +381,153 @@ struct OpPoint {
     {
     }
 
-    OpPoint(SetToNaN) 
+    OpPointOf(SetToNaN) 
         : x(OpNaN)
         , y(OpNaN) {
     }
 
-    OpPoint(float xIn, float yIn) 
+    OpPointOf(T xIn, T yIn) 
         : x(xIn)
         , y(yIn) {
     }
 
-    OpPoint(OpVector v) 
+    OpPointOf(OpVectorOf<T> v) 
         : x(v.dx)
         , y(v.dy) {
     }
 
+    template <typename U>
+    explicit OpPointOf(OpPointOf<U> p)
+        : x((T) p.x)
+        , y((T) p.y) {
+    }
+
     bool isFinite() const;
 
-    friend OpVector operator-(OpPoint a, OpPoint b) {
+    friend OpVectorOf<T> operator-(OpPointOf a, OpPointOf b) {
         return { a.x - b.x, a.y - b.y };
     }
 
-    friend OpVector operator-(OpVector a, OpPoint b) {
+    friend OpVectorOf<T> operator-(OpVectorOf<T> a, OpPointOf b) {
         return { a.dx - b.x, a.dy - b.y };
     }
 
-    friend OpPoint operator+(const OpPoint& a, OpVector b) {  // must be const ref to disambiguate
+    friend OpPointOf operator+(const OpPointOf& a, OpVectorOf<T> b) {  // must be const ref to disambiguate
         return { a.x + b.dx, a.y + b.dy };
     }
 
-    friend bool operator==(OpPoint a, OpPoint b) {
+    friend bool operator==(OpPointOf a, OpPointOf b) {
         return a.x == b.x && a.y == b.y;
     }
 
-    friend bool operator!=(OpPoint a, OpPoint b) {
+    friend bool operator!=(OpPointOf a, OpPointOf b) {
         return a.x != b.x || a.y != b.y;
     }
 
-    void operator+=(OpVector v) {
+    void operator+=(OpVectorOf<T> v) {
         x += v.dx;
         y += v.dy;
     }
 
-    void operator+=(OpPoint v) {
+    void operator+=(OpPointOf v) {
         x += v.x;
         y += v.y;
     }
 
-    void operator-=(OpVector v) {
+    void operator-=(OpVectorOf<T> v) {
         x -= v.dx;
         y -= v.dy;
     }
 
-    void operator*=(float s) {
+    void operator*=(T s) {
         x *= s;
         y *= s;
     }
 
-    void operator/=(float s) {
+    void operator/=(T s) {
         x /= s;
         y /= s;
     }
 
-    OpPoint operator+(OpVector v) {
-        OpPoint result = *this;
+    OpPointOf operator+(OpVectorOf<T> v) {
+        OpPointOf result = *this;
         result += v;
         return result;
     }
 
-    OpPoint operator+(OpPoint v) {
-        OpPoint result = *this;
+    OpPointOf operator+(OpPointOf v) {
+        OpPointOf result = *this;
         result += v;
         return result;
     }
 
-    OpPoint operator-(OpVector v) {
-        OpPoint result = *this;
+    OpPointOf operator-(OpVectorOf<T> v) {
+        OpPointOf result = *this;
         result -= v;
         return result;
     }
 
-    OpPoint operator*(float s) {
-        OpPoint result = *this;
+    OpPointOf operator*(T s) {
+        OpPointOf result = *this;
         result *= s;
         return result;
     }
 
-    friend OpPoint operator*(float a, const OpPoint& b) {  // must be const ref to disambiguate
+    friend OpPointOf operator*(T a, const OpPointOf& b) {  // must be const ref to disambiguate
         return { a * b.x, a * b.y };
     }
 
-    friend OpPoint operator*(const OpPoint& b, float a) {  // must be const ref to disambiguate
+    friend OpPointOf operator*(const OpPointOf& b, T a) {  // must be const ref to disambiguate
         return { a * b.x, a * b.y };
     }
 
-    OpPoint operator/(float s) {
-        OpPoint result = *this;
+    OpPointOf operator/(T s) {
+        OpPointOf result = *this;
         result /= s;
         return result;
     }
 
-    const float* asPtr(Axis axis) const {
+    const T* asPtr(Axis axis) const {
         return &x + +axis;
     }
     
-    float* asPtr(Axis axis) {
+    T* asPtr(Axis axis) {
         return &x + +axis;
     }
     
-    const float* asPtr(XyChoice xyChoice) const {
+    const T* asPtr(XyChoice xyChoice) const {
         return &x + +xyChoice;
     }
 
-    float* asPtr(XyChoice xyChoice) {
+    T* asPtr(XyChoice xyChoice) {
         return &x + +xyChoice;
     }
 
-    static bool Between(OpPoint start, OpPoint mid, OpPoint end);
+    static bool Between(OpPointOf start, OpPointOf mid, OpPointOf end);
 
-    float choice(Axis axis) const {
+    T choice(Axis axis) const {
         return *asPtr(axis);
     }
 
-    float& choice(Axis axis) {
+    T& choice(Axis axis) {
         return *asPtr(axis);
     }
 
-    float choice(XyChoice xyChoice) const {
+    T choice(XyChoice xyChoice) const {
         OP_ASSERT(XyChoice::inZ != xyChoice);
         return *asPtr(xyChoice);
     }
 
-    bool isNearly(OpPoint test) const;
-    void pin(const OpPoint , const OpPoint );
-    void pin(const OpRect& );
-    bool soClose(OpPoint test) const;
+    bool isNearly(OpPointOf test) const;
+    void pin(const OpPointOf , const OpPointOf );
+    void pin(const OpRectOf<T>& );
+    bool soClose(OpPointOf test) const;
 
 
     void zeroTiny() {  // set denormalized inputs to zero
-        if (fabsf(x) < OpEpsilon)
+        if (std::fabs(x) < OpEpsilon)
             x = 0;
-        if (fabsf(y) < OpEpsilon)
+        if (std::fabs(y) < OpEpsilon)
             y = 0;
     }
 
@@ -513,8 +535,8 @@ struct OpPoint {
     DUMP_DECLARATIONS
 #endif
 
-    float x;
-    float y;
+    T x;
+    T y;
 };
 
 #if OP_DEBUG_DUMP
@@ -526,39 +548,48 @@ struct OpHexPoint : OpPoint {
 };
 #endif
 
-inline OpVector::OpVector(OpPoint pt)
+template <typename T>
+inline OpVectorOf<T>::OpVectorOf(OpPointOf<T> pt)
     : dx(pt.x)
     , dy(pt.y) {
 }
 
-struct OpRect {
-    OpRect()
+template <typename T>
+struct OpRectOf {
+    OpRectOf()
         : left(OpNaN)
         , top(OpNaN) 
         , right(OpNaN)
         , bottom(OpNaN) {
     }
 
-    OpRect(float l, float t, float r, float b)
+    OpRectOf(T l, T t, T r, T b)
         : left(l)
         , top(t)
         , right(r)
         , bottom(b) {
     }
 
-    friend bool operator==(OpRect a, OpRect b) {
+    friend bool operator==(OpRectOf a, OpRectOf b) {
         return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom; }
 
-    friend bool operator!=(OpRect a, OpRect b) {
+    friend bool operator!=(OpRectOf a, OpRectOf b) {
         return a.left != b.left || a.top != b.top || a.right != b.right || a.bottom != b.bottom; }
 
-    bool areaOverlaps(const OpRect& r) const {
+    bool areaOverlaps(const OpRectOf& r) const {
+#if OP_SIMD
+        if constexpr (std::is_same_v<T, float>)
+            return OpSimd::AllLess(OpSimd::Load(&left), OpSimd::Load(&r.left));
+#endif
         return r.left < right && left < r.right && r.top < bottom && top < r.bottom;
     }
 
-    OpPoint add(OpPoint pt) {
+    // union is left scalar: bounds are mostly accumulated in loops, where a vector load and
+    // store of the rect on each call is slower than min and max kept in registers (see
+    // speedSimd in TestNewInterface.cpp)
+    OpPointOf<T> add(OpPointOf<T> pt) {
         if (!pt.isFinite())
-            return OpPoint(SetToNaN::dummy);
+            return OpPointOf<T>(SetToNaN::dummy);
         left = std::min(left, pt.x);
         top = std::min(top, pt.y);
         right = std::max(right, pt.x);
@@ -566,7 +597,7 @@ struct OpRect {
         return pt;
     }
 
-    OpRect& add(const OpRect& bounds) {
+    OpRectOf& add(const OpRectOf& bounds) {
         OP_ASSERT(bounds.isFinite());
         left = std::min(left, bounds.left);
         top = std::min(top, bounds.top);
@@ -575,19 +606,23 @@ struct OpRect {
         return *this;
     }
 
-    OpPoint center() const;
+    OpPointOf<T> center() const;
     bool isFinite() const;
 
-    float height() const { 
+    T height() const { 
         return bottom - top; }
 
     bool hasArea() const {
         return width() && height(); }
 
-    bool intersects(const OpRect& r) const {
+    bool intersects(const OpRectOf& r) const {
 #if OP_DEBUG_VALIDATE
         debugValidate();
         r.debugValidate();
+#endif
+#if OP_SIMD
+        if constexpr (std::is_same_v<T, float>)
+            return OpSimd::AllLessOrEqual(OpSimd::Load(&left), OpSimd::Load(&r.left));
 #endif
         return r.left <= right && left <= r.right && r.top <= bottom && top <= r.bottom;
     }
@@ -595,24 +630,24 @@ struct OpRect {
     Axis largerAxis() const {
         return width() >= height() ? Axis::vertical : Axis::horizontal; }
 
-    float ltChoice(Axis axis) const { 
+    T ltChoice(Axis axis) const { 
         return *(&left + +axis);  }
 
-    OpRect outsetClose() const;
+    OpRectOf outsetClose() const;
 
-    float perimeter() const { 
+    T perimeter() const { 
         return width() + height(); }
 
-    float rbChoice(Axis axis) const {
+    T rbChoice(Axis axis) const {
         return *(&right + +axis); }
 
-    float width() const { 
+    T width() const { 
         return right - left; }
 
 #if OP_DEBUG_DUMP
-    virtual ~OpRect() {}
-    OpRect(const OpRect& r) = default;
-    OpRect& operator=(const OpRect& ) = default;
+    virtual ~OpRectOf() {}
+    OpRectOf(const OpRectOf& r) = default;
+    OpRectOf& operator=(const OpRectOf& ) = default;
     virtual std::string debugDump(DebugLevel , DebugBase ) const;
     virtual void dump() const;
     virtual void dump(DebugLevel, DebugBase ) const;
@@ -629,44 +664,45 @@ struct OpRect {
     }
 #endif
 
-    float left;
-    float top;
-    float right;
-    float bottom;
+    T left;
+    T top;
+    T right;
+    T bottom;
 };
 
-struct OpPtT {
-    OpPtT()
+template <typename T>
+struct OpPtTOf {
+    OpPtTOf()
         : t(OpNaN) {
     }
 
-    OpPtT(OpPoint ptIn, float tIn)
+    OpPtTOf(OpPointOf<T> ptIn, T tIn)
         : pt(ptIn)
         , t(tIn) {
     }
 
-    friend bool operator==(OpPtT a, OpPtT b) {
+    friend bool operator==(OpPtTOf a, OpPtTOf b) {
         return a.pt == b.pt && a.t == b.t;
     }
 
-    friend bool operator!=(OpPtT a, OpPtT b) {
+    friend bool operator!=(OpPtTOf a, OpPtTOf b) {
         return a.pt != b.pt || a.t != b.t;
     }
 
-    bool isNearly(const OpPtT& o) const;
+    bool isNearly(const OpPtTOf& o) const;
 
     bool onEnd() const {
         return 0 == t || 1 == t;
     }
 
-    bool soClose(const OpPtT& o) const {
+    bool soClose(const OpPtTOf& o) const {
         constexpr auto epsilon = OpCloseFactor * OpEpsilon;
         return pt.soClose(o.pt) || (t + epsilon >= o.t && t <= o.t + epsilon);
     }
 
     // !!! add point avg and call it here?
-    static void MeetInTheMiddle(OpPtT& a, OpPtT& b) {
-        OpPoint mid = a.onEnd() ? a.pt : b.onEnd() ? b.pt : (a.pt + b.pt) / 2;
+    static void MeetInTheMiddle(OpPtTOf& a, OpPtTOf& b) {
+        OpPointOf<T> mid = a.onEnd() ? a.pt : b.onEnd() ? b.pt : (a.pt + b.pt) / 2;
         a.pt = mid;
         b.pt = mid;
     }
@@ -675,10 +711,12 @@ struct OpPtT {
     DUMP_DECLARATIONS
 #endif
 
-    OpPoint pt;
-    float t;
+    OpPointOf<T> pt;
+    T t;
 };
 
+typedef OpPtTOf<float> OpPtT;
+
 struct OpRootPts {
     OpRootPts() 
         : count(0) {
@@ -728,6 +766,12 @@ struct OpPair {
     float l;  // larger
 };
 
+// polynomials whose roots were certified in float, and polynomials solved again in double
+struct OpRootCounts {
+    int floatPath;
+    int doublePath;
+};
+
 struct OpMath {
     // implementing this with (a + b) / 2 can fail in edge cases where result is <a or >b
     static float Average(float a, float b) {
@@ -744,6 +788,9 @@ struct OpMath {
     static float CloseSmaller(float );
 
 //    static float CubeRoot(float);
+    // tries float first; falls back to CubicRootsReal if any root can't be certified
+    static OpRoots CubicRoots(OpCubicFloatType A, OpCubicFloatType B, OpCubicFloatType C,
+            OpCubicFloatType D, MatchEnds );
     static OpRoots CubicRootsReal(OpCubicFloatType A, OpCubicFloatType B, OpCubicFloatType C,
             OpCubicFloatType D, MatchEnds );
 
@@ -794,6 +841,10 @@ struct OpMath {
     static float PinT(float t) {
         return 0 > t ? 0 : 1 < t ? 1 : t; }
 
+    // tries float first; falls back to QuadRootsDouble if any root can't be certified
+    // callers whose comments name a test that requires double call QuadRootsDouble directly
+    static OpRoots QuadRoots(float A, float B, float C);
+
     static OpRoots QuadRootsReal(float A, float B, float C) {
         if (0 == A) {
             if (0 == B) {
@@ -847,6 +898,9 @@ struct OpMath {
             pts[index].zeroTiny();
     }
 
+    // per thread, so that each context can attribute the counts to its own resolve
+    static thread_local OpRootCounts RootCounts;
+
 #if OP_DEBUG
     static void DebugCompare(float a, float b);
 
@@ -883,4 +937,97 @@ struct LinePts {
     std::array<OpPoint, 2> pts;
 };
 
+// geometry members that depend on OpMath
+
+template <typename T>
+OpVectorOf<T> OpVectorOf<T>::normalize() {
+    T len = length();
+    if (!OpMath::IsFinite(len))
+        return { 0, 0 };
+    if (!len)
+        return { OpNaN, OpNaN };
+    T inverseLength = 1 / len;
+    dx *= inverseLength;
+    dy *= inverseLength;
+    return *this;
+}
+
+template <typename T>
+bool OpVectorOf<T>::isFinite() const {
+    return OpMath::IsFinite(dx) && OpMath::IsFinite(dy);
+}
+
+// Use the axis with the greatest change to decide if mid is between start and end.
+// While this doesn't work in general, the callers are dealing with coincident curves
+// which may be close, but not on top of each other. When they are axis-aligned, the
+// larger provides a better metric of whether multiple curves overlap.
+template <typename T>
+bool OpPointOf<T>::Between(OpPointOf<T> start, OpPointOf<T> mid, OpPointOf<T> end) {
+    OpVectorOf<T> scope = end - start;
+    XyChoice xy = scope.larger();
+    return OpMath::Between(start.choice(xy), mid.choice(xy), end.choice(xy));
+}
+
+template <typename T>
+bool OpPointOf<T>::isFinite() const {
+#if OP_DEBUG
+    if (OpMath::IsNaN(x)) {
+        int32_t xBits = OpDebugFloatToBits(x);
+        OP_ASSERT(!(xBits & 1));
+    }
+    if (OpMath::IsNaN(y)) {
+        int32_t yBits = OpDebugFloatToBits(y);
+        OP_ASSERT(!(yBits & 1));
+    }
+#endif
+    // return *this * 0 == OpPoint(0, 0);  // does not work with MSVC and /fp:fast
+    return OpMath::IsFinite(x) && OpMath::IsFinite(y);
+}
+
+template <typename T>
+bool OpPointOf<T>::isNearly(OpPointOf<T> test) const {
+    return OpMath::Equalish(x, test.x) && OpMath::Equalish(y, test.y);
+}
+
+template <typename T>
+void OpPointOf<T>::pin(const OpPointOf<T> a, const OpPointOf<T> b) {
+    x = OpMath::PinUnsorted(a.x, x, b.x);
+    y = OpMath::PinUnsorted(a.y, y, b.y);
+}
+
+template <typename T>
+void OpPointOf<T>::pin(const OpRectOf<T>& r) {
+    x = OpMath::PinSorted(r.left, x, r.right);
+    y = OpMath::PinSorted(r.top, y, r.bottom);
+}
+
+template <typename T>
+bool OpPointOf<T>::soClose(OpPointOf<T> test) const {
+    return OpMath::Between(OpMath::CloseSmaller(x), test.x, OpMath::CloseLarger(x))
+        && OpMath::Between(OpMath::CloseSmaller(y), test.y, OpMath::CloseLarger(y));
+}
+
+template <typename T>
+OpPointOf<T> OpRectOf<T>::center() const { 
+    return { OpMath::Average(left, right), OpMath::Average(top, bottom) }; 
+}
+
+template <typename T>
+bool OpRectOf<T>::isFinite() const {
+    return OpMath::IsFinite(left) && OpMath::IsFinite(top)
+        && OpMath::IsFinite(right) && OpMath::IsFinite(bottom);
+}
+
+template <typename T>
+OpRectOf<T> OpRectOf<T>::outsetClose() const {
+    OpRectOf<T> result = { OpMath::CloseSmaller(left), OpMath::CloseSmaller(top),
+	        OpMath::CloseLarger(right), OpMath::CloseLarger(bottom) };
+    return result;
+}
+
+template <typename T>
+bool OpPtTOf<T>::isNearly(const OpPtTOf<T>& o) const {
+    return pt.isNearly(o.pt) || OpMath::NearlyEqualT(t, o.t);
+}
+
 #endif
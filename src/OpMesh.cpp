@@ -0,0 +1,131 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#include "OpMesh.h"
+
+float OpMeshEdge::xAt(float y) const {
+	if (y <= top.y)
+		return top.x;
+	if (y >= bottom.y)
+		return bottom.x;
+	return OpMath::Interp(top.x, bottom.x, (y - top.y) / (bottom.y - top.y));
+}
+
+// horizontal lines are skipped; they never span a slab
+void OpMesh::addContours(const OpArray<OpPoint>& points, const OpArray<size_t>& ends) {
+	size_t start = 0;
+	for (size_t end : ends) {
+		for (size_t index = start; index < end; ++index) {
+			OpPoint pt = points[index];
+			OpPoint next = points[index + 1 < end ? index + 1 : start];  // close contour
+			if (pt.y < next.y)
+				edges.push_back({ pt, next });
+			else if (pt.y > next.y)
+				edges.push_back({ next, pt });
+		}
+		start = end;
+	}
+}
+
+// adds the corners as vertices, so that trapezoids sharing a height find them when filled
+void OpMesh::close(const OpMeshTrap& trap, float bottom) {
+	OpMeshQuad quad { trap.topLeft, trap.topRight, { edges[trap.left].xAt(bottom), bottom },
+			{ edges[trap.right].xAt(bottom), bottom } };
+	vertex(quad.topLeft);
+	vertex(quad.topRight);
+	vertex(quad.bottomLeft);
+	vertex(quad.bottomRight);
+	quads.push_back(quad);
+}
+
+// top and bottom are parallel, so triangles may step along either one in x order
+void OpMesh::fill(const OpMeshQuad& quad) {
+	OpArray<uint32_t> top;
+	OpArray<uint32_t> bottom;
+	verticesOn(quad.topLeft.y, quad.topLeft.x, quad.topRight.x, top);
+	verticesOn(quad.bottomLeft.y, quad.bottomLeft.x, quad.bottomRight.x, bottom);
+	size_t t = 0;
+	size_t b = 0;
+	while (t + 1 < top.size() || b + 1 < bottom.size()) {
+		if (b + 1 == bottom.size() 
+				|| (t + 1 < top.size() && vertices[top[t + 1]].x <= vertices[bottom[b + 1]].x)) {
+			indices.insert(indices.end(), { top[t], top[t + 1], bottom[b] });
+			++t;
+		} else {
+			indices.insert(indices.end(), { top[t], bottom[b + 1], bottom[b] });
+			++b;
+		}
+	}
+}
+
+void OpMesh::triangulate() {
+	std::sort(edges.begin(), edges.end(), [](const OpMeshEdge& a, const OpMeshEdge& b) {
+		return a.top.y < b.top.y; });
+	OpArray<float> ys;
+	for (const OpMeshEdge& edge : edges) {
+		ys.push_back(edge.top.y);
+		ys.push_back(edge.bottom.y);
+	}
+	std::sort(ys.begin(), ys.end());
+	ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+	OpArray<int> active;
+	OpArray<OpMeshTrap> traps;
+	OpArray<OpMeshTrap> nextTraps;
+	OpArray<bool> carried;
+	OpArray<int> trapOfLeft(edges.size(), -1);
+	size_t edgeIndex = 0;
+	for (size_t slab = 0; slab + 1 < ys.size(); ++slab) {
+		float top = ys[slab];
+		float bottom = ys[slab + 1];
+		// every vertex height starts a slab, so an active edge spans the whole slab
+		active.erase(std::remove_if(active.begin(), active.end(), [this, top](int index) {
+				return edges[index].bottom.y <= top; }), active.end());
+		while (edgeIndex < edges.size() && edges[edgeIndex].top.y <= top)
+			active.push_back((int) edgeIndex++);
+		float middle = OpMath::Average(top, bottom);
+		std::sort(active.begin(), active.end(), [this, middle](int a, int b) {
+			return edges[a].xAt(middle) < edges[b].xAt(middle); });
+		OP_ASSERT(!(active.size() & 1));
+		nextTraps.clear();
+		carried.assign(traps.size(), false);
+		for (size_t index = 0; index + 1 < active.size(); index += 2) {
+			int left = active[index];
+			int right = active[index + 1];
+			int prior = trapOfLeft[left];
+			if (prior >= 0 && traps[prior].right == right) {
+				nextTraps.push_back(traps[prior]);
+				carried[prior] = true;
+				continue;
+			}
+			nextTraps.push_back({ left, right, { edges[left].xAt(top), top },
+					{ edges[right].xAt(top), top } });
+		}
+		for (size_t index = 0; index < traps.size(); ++index) {
+			trapOfLeft[traps[index].left] = -1;
+			if (!carried[index])
+				close(traps[index], top);
+		}
+		traps.swap(nextTraps);
+		for (size_t index = 0; index < traps.size(); ++index)
+			trapOfLeft[traps[index].left] = (int) index;
+	}
+	for (const OpMeshTrap& trap : traps)
+		close(trap, ys.back());
+	for (const OpMeshQuad& quad : quads)
+		fill(quad);
+}
+
+uint32_t OpMesh::vertex(OpPoint pt) {
+	auto found = vertexMap.find({ pt.y, pt.x });
+	if (vertexMap.end() != found)
+		return found->second;
+	uint32_t index = (uint32_t) vertices.size();
+	vertexMap[{ pt.y, pt.x }] = index;
+	vertices.push_back(pt);
+	return index;
+}
+
+// appends the vertices at y from left to right inclusive, in x order
+void OpMesh::verticesOn(float y, float left, float right, OpArray<uint32_t>& found) {
+	auto last = vertexMap.upper_bound({ y, right });
+	for (auto entry = vertexMap.lower_bound({ y, left }); last != entry; ++entry)
+		found.push_back(entry->second);
+}
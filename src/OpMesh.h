@@ -0,0 +1,55 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef OpMesh_DEFINED
+#define OpMesh_DEFINED
+
+#include <map>
+#include "OpArena.h"
+
+// line from flattened output contour, oriented so that top.y is less than bottom.y
+struct OpMeshEdge {
+	float xAt(float y) const;
+
+	OpPoint top;
+	OpPoint bottom;
+};
+
+// trapezoid bounded by a left and right edge, open until the pair no longer spans a slab
+struct OpMeshTrap {
+	int left;  // index into mesh edges
+	int right;
+	OpPoint topLeft;
+	OpPoint topRight;
+};
+
+// trapezoid closed at the bottom of its last slab; filled once every vertex is known
+struct OpMeshQuad {
+	OpPoint topLeft;
+	OpPoint topRight;
+	OpPoint bottomLeft;
+	OpPoint bottomRight;
+};
+
+// Splits the output contours into horizontal slabs, one between each pair of adjacent vertex
+// heights. Since output contours do not cross, edges in a slab pair up left to right to bound
+// the filled spans. A trapezoid stays open as long as the same pair of edges bounds it, so
+// the triangle count grows with the number of edges, not with edges times slabs.
+// Trapezoids above and below a vertex height may end at different places along it, so each
+// is filled with every vertex on its top and bottom, and triangles meet side to side.
+struct OpMesh {
+	void addContours(const OpArray<OpPoint>& points, const OpArray<size_t>& ends);
+	void close(const OpMeshTrap& , float bottom);
+	void fill(const OpMeshQuad& );
+	void triangulate();
+	uint32_t vertex(OpPoint );
+	void verticesOn(float y, float left, float right, OpArray<uint32_t>& );
+
+	OpArray<OpMeshEdge> edges;
+	OpArray<OpMeshQuad> quads;
+	// (y, x) to index in vertices
+	std::map<std::pair<float, float>, uint32_t, std::less<std::pair<float, float>>,
+			OpAllocator<std::pair<const std::pair<float, float>, uint32_t>>> vertexMap;
+	OpArray<OpPoint> vertices;
+	OpArray<uint32_t> indices;  // three per triangle
+};
+
+#endif
@@ -1,8 +1,9 @@
 // (c) 2023, Cary Clark cclark2@gmail.com
 #include "OpContour.h"
 #include "OpSegment.h"
+#include "OpSegments.h"
 
-void FoundEdge::check(std::vector<FoundEdge>* edges, OpEdge* test, EdgeMatch em, OpPoint match) {
+void FoundEdge::check(OpArray<FoundEdge>* edges, OpEdge* test, EdgeMatch em, OpPoint match) {
     if (edges && edges->size())
         return;
     float gapSq = (test->whichPtT(em).pt - match).lengthSquared();
@@ -31,6 +32,7 @@ OpSegment::OpSegment(const OpCurve& pts, OpType type, OpContour* contourPtr
     : contour(contourPtr)
     , c(pts.pts, pts.weightImpl, type)
     , winding(WindingUninitialized::dummy)
+    , boundsIndex(-1)
     , disabled(false)  {
     complete();
     OP_DEBUG_CODE(debugStart = startReason);
@@ -43,6 +45,7 @@ OpSegment::OpSegment(const LinePts& pts, OpContour* contourPtr
     : contour(contourPtr)
     , c(&pts.pts.front(), OpType::line)
     , winding(WindingUninitialized::dummy)
+    , boundsIndex(-1)
     , disabled(false)  {
     complete();
     OP_DEBUG_CODE(debugStart = startReason);
@@ -58,7 +61,7 @@ OpSegment::OpSegment(const LinePts& pts, OpContour* contourPtr
 // returns true if emplaced edge has pals
 
 // activeNeighbor is called separately because this iterates through opposite intersections only
-bool OpSegment::activeAtT(const OpEdge* edge, EdgeMatch match, std::vector<FoundEdge>& oppEdges,
+bool OpSegment::activeAtT(const OpEdge* edge, EdgeMatch match, OpArray<FoundEdge>& oppEdges,
         bool* hadLinkTo) const {
     unsigned edgesSize = oppEdges.size();
     OP_ASSERT(!edge->disabled);
@@ -107,7 +110,7 @@ bool OpSegment::activeAtT(const OpEdge* edge, EdgeMatch match, std::vector<Found
 
 // returns true if emplaced edge has pals
 bool OpSegment::activeNeighbor(const OpEdge* edge, EdgeMatch match, 
-        std::vector<FoundEdge>& oppEdges) const {
+        OpArray<FoundEdge>& oppEdges) const {
     if ((EdgeMatch::start == match && edge->start.t == 0)
             || (EdgeMatch::end == match && edge->end.t == 1))
         return false;
@@ -180,8 +183,12 @@ int OpSegment::coinID(bool flipped) const {
     return flipped ? -coinID : coinID;
 }
 
+// type dependent properties are read once here, so that intersecting segments does not call back
 void OpSegment::complete() {
+    ptCount = c.pointCount();
+    isLine = c.isLine();
     setBounds();
+    setCurveProperties();
 // #if OP_DEBUG     // !!! used only by sort; probably unnecessary?
     id = nextID();  // segment's contour pointer is not set up
 // #endif
@@ -199,7 +206,7 @@ OpEdge* OpSegment::findEnabled(const OpPtT& ptT, EdgeMatch match) const {
 // used to find unsectable range; assumes range all has about the same slope
 // !!! this may be a bad idea if two near coincident edges turn near 90 degrees
 float OpSegment::findAxisT(Axis axis, float start, float end, float opp) const {
-    if (!c.isLine()) {
+    if (!isLine) {
         OpRoots roots = c.axisRayHit(axis, opp, start, end);
         if (1 == roots.count)
             return roots.roots[0];
@@ -227,7 +234,7 @@ float OpSegment::findNearbyT(const OpPtT& start, const OpPtT& end, OpPoint opp)
 // returns t iff opp point is between start and end
 // start/end range is necessary since cubics can have more than one t at a point
 float OpSegment::findValidT(float start, float end, OpPoint opp) const {
-    if (!c.isLine()) {
+    if (!isLine) {
         OpRoots hRoots = c.axisRayHit(Axis::horizontal, opp.y, start, end);
         OpRoots vRoots = c.axisRayHit(Axis::vertical, opp.x, start, end);
         if (1 != hRoots.count && 1 != vRoots.count) {
@@ -324,6 +331,9 @@ void OpSegment::moveTo(float matchT, OpPoint equalPt) {
     if (c.firstPt() == c.lastPt())
         disabled = true;
     setBounds();
+    setCurveProperties();
+    if (OpSegments* sorted = contour->contours->resolveSegments)
+        sorted->setMoved(this);
     for (OpIntersection* sect : sects.i) {
         if (sect->ptT.t == matchT) {
             sect->ptT.pt = equalPt;
@@ -350,23 +360,32 @@ int OpSegment::nextID() const {
 void OpSegment::setBounds() {
     ptBounds = c.ptBounds();
     closeBounds = ptBounds.outsetClose();
+    if (OpSegments* sorted = contour->contours->resolveSegments)
+        sorted->setBounds(this);
+}
+
+// point dependent properties; requires that bounds are set
+void OpSegment::setCurveProperties() {
+    axisAligned = ptBounds.left == ptBounds.right || ptBounds.top == ptBounds.bottom;
 }
 
 // should be inlined. Out of line for ease of setting debugging breakpoints
 void OpSegment::setDisabled(OP_DEBUG_CODE(ZeroReason reason)) {
 	disabled = true; 
     OP_DEBUG_CODE(debugZero = reason); 
+    if (OpSegments* sorted = contour->contours->resolveSegments)
+        sorted->setBounds(this);
 }
 
 // at present, only applies to horizontal and vertical lines
 // !!! experiment: add support for linear diagonals
 void OpSegment::windCoincidences() {
-    if (!c.isLine())
+    if (!isLine)
         return;
     if (disabled)
         return;
-    OpVector tangent = c.lastPt() - c.firstPt();
-    if (tangent.dx && tangent.dy) {
+    OP_DEBUG_CODE(OpVector tangent = c.lastPt() - c.firstPt());
+    if (!axisAligned) {
         // iterate through edges; if edge is linear and matches opposite, mark both coincident
         bool foundCoincidence  = false;
         for (OpEdge& edge : edges) {
@@ -478,6 +497,7 @@ OpSegment::OpSegment(PathOpsV0Lib::AddCurve addCurve, PathOpsV0Lib::AddWinding a
             { (PathOpsV0Lib::CurveData*) addCurve.points, addCurve.size, addCurve.type } )
     , winding((OpContour*) addWinding.contour, 
             { (PathOpsV0Lib::WindingData*) addWinding.windings, addWinding.size } )
+    , boundsIndex(-1)
     , disabled(false)  {
     complete();
     OP_DEBUG_CODE(debugStart = SectReason::test);   // temp for new interface
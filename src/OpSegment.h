@@ -5,7 +5,6 @@
 #include "OpEdge.h"
 #include "OpIntersection.h"
 #include "OpTightBounds.h"
-#include <vector>
 
 struct OpContour;
 
@@ -37,7 +36,7 @@ struct FoundEdge {
         , loops(false) {
     }
 
-    void check(std::vector<FoundEdge>* edges, OpEdge* test, EdgeMatch , OpPoint match);
+    void check(OpArray<FoundEdge>* edges, OpEdge* test, EdgeMatch , OpPoint match);
     void reset();
 #if OP_DEBUG_DUMP
 	DUMP_DECLARATIONS
@@ -59,8 +58,8 @@ struct OpSegment {
     OpSegment(const OpCurve& pts, OpType type, OpContour*  
             OP_DEBUG_PARAMS(SectReason , SectReason ));
     OpSegment(const LinePts& pts, OpContour*  OP_DEBUG_PARAMS(SectReason , SectReason ));
-    bool activeAtT(const OpEdge* , EdgeMatch , std::vector<FoundEdge>& , bool* hadLinkTo) const;
-    bool activeNeighbor(const OpEdge* , EdgeMatch , std::vector<FoundEdge>& ) const;
+    bool activeAtT(const OpEdge* , EdgeMatch , OpArray<FoundEdge>& , bool* hadLinkTo) const;
+    bool activeNeighbor(const OpEdge* , EdgeMatch , OpArray<FoundEdge>& ) const;
     OpIntersection* addEdgeSect(const OpPtT&    
             OP_LINE_FILE_DEF(SectReason , const OpEdge* e, const OpEdge* o));
     OpIntersection* addSegBase(const OpPtT&  
@@ -90,6 +89,7 @@ struct OpSegment {
 //	void reenable() {
 //		disabled = false; OP_DEBUG_CODE(debugZero = ZeroReason::uninitialized); }
     void setBounds();
+    void setCurveProperties();
 	void setDisabled(OP_DEBUG_CODE(ZeroReason reason));
     void windCoincidences();
 
@@ -119,8 +119,12 @@ struct OpSegment {
     OpPointBounds ptBounds;
     OpRect closeBounds;
     OpIntersections sects;
-    std::vector<OpEdge> edges;
+    OpArray<OpEdge> edges;
     OpWinding winding;
+    int ptCount;  // set once from curve callback; includes end points
+    int boundsIndex;  // position in OpSegments inX, set when segments are sorted
+    bool isLine;  // set once from curve callback
+    bool axisAligned;  // points all share x or y; set again when end points move
     bool disabled; // winding has canceled this edge out
     int id;     // !!! could be debug only; currently used to disambiguate sort, may be unneeded
 #if OP_DEBUG
@@ -20,32 +20,59 @@ static bool compareXBox(const OpSegment* s1, const OpSegment* s2) {
     return s1->id < s2->id;
 }
 
-OpSegments::OpSegments(OpContours& contours) {
+OpSegments::OpSegments(OpContours& c)
+    : contours(&c)
+    , sweepIndex(0)
+    , sweptEnd(0)
+    , nextMatch(0)
+    , endsSorted(false)
+    , endsSwept(false)
+    , segIndex(0)
+    , oppIndex(0) {
     inX.clear();
-    for (auto contour : contours.contours) {
+    for (auto contour : c.contours) {
         for (auto& segment : contour->segments) {
             inX.push_back(&segment);
         }
     }
     std::sort(inX.begin(), inX.end(), compareXBox);
+    lefts.resize(inX.size());
+    tops.resize(inX.size());
+    rights.resize(inX.size());
+    bottoms.resize(inX.size());
+    moved.resize(inX.size());
+    for (size_t index = 0; index < inX.size(); ++index) {
+        inX[index]->boundsIndex = (int) index;
+        setBounds(inX[index]);
+    }
+}
+
+void OpSegments::AddEndSect(OpSegment* seg, OpSegment* opp, OpPoint pt, float segT, float oppT
+        OP_LINE_FILE_DEF(SectReason reason)) {
+    if (opp->disabled || seg->disabled)
+        return;
+    if (seg->sects.contains(OpPtT { pt, segT }, opp) 
+            || opp->sects.contains(OpPtT { pt, oppT }, seg))
+        return;
+    OpIntersection* sect = seg->addSegSect(OpPtT { pt, segT }, opp  
+            OP_LINE_FILE_CALLER(reason));
+    OpIntersection* oSect = opp->addSegSect(OpPtT { pt, oppT }, seg 
+            OP_LINE_FILE_CALLER(reason));
+    sect->pair(oSect);
 }
 
 // may need to adjust values in opp if end is nearly equal to seg
-void OpSegments::AddEndMatches(OpSegment* seg, OpSegment* opp) {
+// if match ends found no nearly equal ends for the pair, and neither segment has moved since,
+// the end checks are skipped; the interior checks below still run
+void OpSegments::AddEndMatches(OpSegment* seg, OpSegment* opp, bool endsApart) {
     auto add = [seg, opp](OpPoint pt, float segT, float oppT   OP_LINE_FILE_DEF(int dummy)) {
-        if (opp->disabled || seg->disabled)
-            return;
-        if (seg->sects.contains(OpPtT { pt, segT }, opp) 
-                || opp->sects.contains(OpPtT { pt, oppT }, seg))
-            return;
-        OpIntersection* sect = seg->addSegSect(OpPtT { pt, segT }, opp  
-                OP_LINE_FILE_CALLER(SectReason::lineCurve));
-        OpIntersection* oSect = opp->addSegSect(OpPtT { pt, oppT }, seg 
-                OP_LINE_FILE_CALLER(SectReason::lineCurve));
-        sect->pair(oSect);
+        AddEndSect(seg, opp, pt, segT, oppT  OP_LINE_FILE_CALLER(SectReason::lineCurve));
     };
-    auto checkEnds = [add, seg, opp](OpPoint oppPt, float oppT  OP_LINE_FILE_DEF(int dummy)) {
+    auto checkEnds = [add, seg, opp, endsApart](OpPoint oppPt, float oppT  
+            OP_LINE_FILE_DEF(int dummy)) {
         float segT = OpNaN;
+        if (endsApart)
+            return segT;
         if (seg->c.firstPt().isNearly(oppPt)) {
             segT = 0;
             if (oppPt != seg->c.firstPt()) {
@@ -100,7 +127,7 @@ void OpSegments::AddEndMatches(OpSegment* seg, OpSegment* opp) {
 // somewhat different from winder's edge based version, probably for no reason
 void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
     OP_ASSERT(opp != seg);
-    OP_ASSERT(seg->c.isLine());
+    OP_ASSERT(seg->isLine);
     LinePts edgePts { seg->c.firstPt(), seg->c.lastPt() };
     MatchReverse matchRev = seg->matchEnds(opp);
     if (matchRev.reversed) {
@@ -118,7 +145,7 @@ void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
 		septs.roots[0] = rotated.tZeroX(0, 1);
 		septs.count = 1;
 	}
-    if (opp->c.isLine() && MatchEnds::both == matchRev.match) {
+    if (opp->isLine && MatchEnds::both == matchRev.match) {
 #if OP_TEST_NEW_INTERFACE
         seg->winding.move(opp->winding, edgePts.pts[0] != edgePts.pts[1]);
 #else
@@ -130,7 +157,7 @@ void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
         opp->setDisabled(OP_DEBUG_CODE(ZeroReason::addIntersection));
         return;
     }
-    if (2 == septs.count && opp->c.isLine()) {
+    if (2 == septs.count && opp->isLine) {
         OpWinder::CoincidentCheck({ edgePts.pts[0], 0 }, { edgePts.pts[1], 1 },
                 { opp->c.firstPt(), 0}, { opp->c.lastPt(), 1 }, seg, opp );
         return;
@@ -141,8 +168,8 @@ void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
     if (!!(MatchEnds::end & matchRev.match))
         septs.addEnd(1);
 #endif
-    std::vector<OpPtT> oppPtTs;
-    std::vector<OpPtT> edgePtTs;
+    OpArray<OpPtT> oppPtTs;
+    OpArray<OpPtT> edgePtTs;
     for (unsigned index = 0; index < septs.count; ++index) {
         float oppT = septs.get(index);
         if (OpMath::NearlyEndT(oppT))
@@ -269,12 +296,12 @@ void OpSegments::FindCoincidences(OpContours* contours) {
 // !!! this is comically complicated
 // surely even if all this is needed, it can be more clearly written and use less code ...
 IntersectResult OpSegments::LineCoincidence(OpSegment* seg, OpSegment* opp) {
-    OP_ASSERT(seg->c.isLine());
+    OP_ASSERT(seg->isLine);
     OP_ASSERT(!seg->disabled);
     OpVector tangent = seg->c.tangent(0);
     if (!tangent.dx || !tangent.dy) {
         OP_ASSERT(tangent.dx || tangent.dy);
-        OP_ASSERT(opp->c.isLine());
+        OP_ASSERT(opp->isLine);
         OP_ASSERT(!opp->disabled);
         OpVector oTangent = opp->c.tangent(0);
         if (oTangent.dx && oTangent.dy)
@@ -405,27 +432,40 @@ IntersectResult OpSegments::LineCoincidence(OpSegment* seg, OpSegment* opp) {
 }
 
 // note: ends have already been matched for consecutive segments
-FoundIntersections OpSegments::findIntersections() {
-    for (auto segIter = inX.begin(); segIter != inX.end(); ++segIter) {
-        OpSegment* seg = const_cast<OpSegment*>(*segIter);
+// each segment pair checked uses one unit of budget; returns paused if budget runs out
+// or if resolve is cancelled or out of time
+FoundIntersections OpSegments::findIntersections(size_t& budget) {
+    if (!endsSwept && !matchEnds(budget))
+        return FoundIntersections::paused;
+    for (; segIndex < inX.size(); ++segIndex, oppIndex = 0) {
+        OpSegment* seg = inX[segIndex];
         if (seg->disabled)
             continue;
-        for (auto oppIter = segIter + 1; oppIter != inX.end(); ++oppIter) {
-            OpSegment* opp = const_cast<OpSegment*>(*oppIter);
-            if (opp->disabled)
-                continue;
+        if (!oppIndex)
+            oppIndex = segIndex + 1;
+        for (; oppIndex < inX.size(); ++oppIndex) {
             // comparisons below need to be 'nearly' since adjusting opp may make sort incorrect
             // or, exact compare may miss nearly equal seg/opp pairs
-            if (seg->closeBounds.right < opp->closeBounds.left)
+            oppIndex = nextOverlap(seg->closeBounds, oppIndex);
+            if (oppIndex >= inX.size())
                 break;
-            if (!seg->closeBounds.intersects(opp->closeBounds))
-                continue;
-            AddEndMatches(seg, opp);
+            if (contours->stopStep(budget))
+                return FoundIntersections::paused;
+            OpSegment* opp = inX[oppIndex];
+            // pairs are visited in the order end matches are sorted; skip any not visited
+            while (nextMatch < endMatches.size() && (endMatches[nextMatch].segIndex < segIndex
+                    || (endMatches[nextMatch].segIndex == segIndex 
+                    && endMatches[nextMatch].oppIndex < oppIndex)))
+                ++nextMatch;
+            bool endsMatch = nextMatch < endMatches.size() 
+                    && endMatches[nextMatch].segIndex == segIndex
+                    && endMatches[nextMatch].oppIndex == oppIndex;
+            AddEndMatches(seg, opp, !endsMatch && !moved[segIndex] && !moved[oppIndex]);
             if (opp->disabled)
                 continue;
             // for line-curve intersection we can directly intersect
-            if (seg->c.isLine()) {
-                if (opp->c.isLine()) {
+            if (seg->isLine) {
+                if (opp->isLine) {
                     IntersectResult lineCoin = LineCoincidence(seg, opp);
                     if (IntersectResult::fail == lineCoin)
                         return FoundIntersections::fail;
@@ -434,7 +474,7 @@ FoundIntersections OpSegments::findIntersections() {
                 }
                 AddLineCurveIntersection(opp, seg);
                 continue;
-            } else if (opp->c.isLine()) {
+            } else if (opp->isLine) {
                 AddLineCurveIntersection(seg, opp);
                 continue;
             }
@@ -455,9 +495,12 @@ FoundIntersections OpSegments::findIntersections() {
 #if OP_DEBUG_DUMP
             OP_ASSERT(!cc.dumpBreak());
 #endif
+            if (PathOpsV0Lib::ContextError::none != contours->error)
+                return FoundIntersections::fail;  // curve/curve depth exceeded limit
             if (SectFound::fail == ccResult || SectFound::maxOverlaps == ccResult) {
                 // !!! as an experiment, search runs for small opp distances; turn found into limits
                 SectFound limitsResult = cc.runsToLimits();
+                ++contours->counts.curveCurveFallbacks;
                 if (SectFound::add == limitsResult)
                     ccResult = limitsResult;
                 else if (SectFound::fail == limitsResult) {
@@ -570,6 +613,98 @@ FoundIntersections OpSegments::findIntersections() {
     return FoundIntersections::yes; // !!! if something can fail, return 'fail' (don't return 'no')
 }
 
+// returns the index of the first opp at or after oppIndex whose bounds intersect segBounds,
+// or inX.size() if there is none, or if an opp's left is beyond segBounds' right first
+size_t OpSegments::nextOverlap(const OpRect& segBounds, size_t oppIndex) const {
+    size_t count = inX.size();
+#if OP_SIMD
+    for (; oppIndex + 4 <= count; oppIndex += 4) {
+        int beyond;
+        int overlaps = OpSimd::Intersects4(&segBounds.left, &lefts[oppIndex], &tops[oppIndex],
+                &rights[oppIndex], &bottoms[oppIndex], &beyond);
+        int found = overlaps | beyond;
+        if (!found)
+            continue;
+        int lane = 0;
+        while (!(found & (1 << lane)))
+            ++lane;
+        return beyond & (1 << lane) ? count : oppIndex + lane;
+    }
+#endif
+    for (; oppIndex < count; ++oppIndex) {
+        if (segBounds.right < lefts[oppIndex])
+            return count;
+        if (lefts[oppIndex] <= segBounds.right && segBounds.left <= rights[oppIndex]
+                && tops[oppIndex] <= segBounds.bottom && segBounds.top <= bottoms[oppIndex])
+            return oppIndex;
+    }
+    return count;
+}
+
+// Finds segment pairs with nearly equal ends before segment pairs are checked, so that pairs
+// without them need not compare all four end combinations. Ends are sorted by x, then each end
+// is compared with the ends that follow while their x is nearly equal. Ends are not moved here;
+// find intersections snaps each listed pair when it visits it, so that snaps and intersections
+// interleave in pair order. Each segment and each end swept uses one unit of budget; returns
+// false if paused.
+bool OpSegments::matchEnds(size_t& budget) {
+    for (; sweepIndex < inX.size(); ++sweepIndex) {
+        if (contours->stopStep(budget))
+            return false;
+        const OpSegment* segment = inX[sweepIndex];
+        if (segment->disabled)
+            continue;
+        sweepEnds.push_back({ segment->c.firstPt(), sweepIndex });
+        sweepEnds.push_back({ segment->c.lastPt(), sweepIndex });
+    }
+    if (!endsSorted) {
+        std::sort(sweepEnds.begin(), sweepEnds.end(), 
+                [](const OpSegmentEnd& s1, const OpSegmentEnd& s2) {
+            return s1.pt.x < s2.pt.x || (s1.pt.x == s2.pt.x && s1.pt.y < s2.pt.y);
+        });
+        endsSorted = true;
+    }
+    for (; sweptEnd < sweepEnds.size(); ++sweptEnd) {
+        if (contours->stopStep(budget))
+            return false;
+        const OpSegmentEnd& end = sweepEnds[sweptEnd];
+        for (size_t next = sweptEnd + 1; next < sweepEnds.size(); ++next) {
+            const OpSegmentEnd& test = sweepEnds[next];
+            if (!OpMath::Equalish(end.pt.x, test.pt.x))
+                break;
+            if (end.index == test.index || !end.pt.isNearly(test.pt))
+                continue;
+            endMatches.push_back({ std::min(end.index, test.index), 
+                    std::max(end.index, test.index) });
+        }
+    }
+    std::sort(endMatches.begin(), endMatches.end(), 
+            [](const OpEndMatch& m1, const OpEndMatch& m2) {
+        return m1.segIndex < m2.segIndex 
+                || (m1.segIndex == m2.segIndex && m1.oppIndex < m2.oppIndex);
+    });
+    sweepEnds.clear();
+    endsSwept = true;
+    return true;
+}
+
+// called when a segment's bounds change or it is disabled
+void OpSegments::setBounds(const OpSegment* segment) {
+    size_t index = (size_t) segment->boundsIndex;
+    OP_ASSERT(index < inX.size() && segment == inX[index]);
+    bool disabled = segment->disabled;
+    lefts[index] = disabled ? OpNaN : segment->closeBounds.left;
+    tops[index] = disabled ? OpNaN : segment->closeBounds.top;
+    rights[index] = disabled ? OpNaN : segment->closeBounds.right;
+    bottoms[index] = disabled ? OpNaN : segment->closeBounds.bottom;
+}
+
+void OpSegments::setMoved(const OpSegment* segment) {
+    size_t index = (size_t) segment->boundsIndex;
+    OP_ASSERT(index < inX.size() && segment == inX[index]);
+    moved[index] = true;
+}
+
 #if 0
 // new interface
 FoundIntersections OpSegments::findIntersectionsX() {
@@ -589,8 +724,8 @@ FoundIntersections OpSegments::findIntersectionsX() {
                 continue;
             AddEndMatches(seg, opp);
             // for line-curve intersection we can directly intersect
-            if (seg->c.isLine()) {
-                if (opp->c.isLine()) {
+            if (seg->isLine) {
+                if (opp->isLine) {
                     IntersectResult lineCoin = LineCoincidence(seg, opp);
                     if (IntersectResult::fail == lineCoin)
                         return FoundIntersections::fail;
@@ -599,7 +734,7 @@ FoundIntersections OpSegments::findIntersectionsX() {
                 }
                 AddLineCurveIntersection(opp, seg);
                 continue;
-            } else if (opp->c.isLine()) {
+            } else if (opp->isLine) {
                 AddLineCurveIntersection(seg, opp);
                 continue;
             }
@@ -8,24 +8,61 @@ struct OpContours;
 struct OpSegment;
 enum class FoundIntersections;
 enum class IntersectResult;
+enum class SectReason;
+
+struct OpSegmentEnd {
+    OpPoint pt;
+    size_t index;  // of segment in inX
+};
+
+// segments in inX, seg before opp, with nearly equal ends
+struct OpEndMatch {
+    size_t segIndex;
+    size_t oppIndex;
+};
 
 struct OpSegments {
     OpSegments(OpContours& contours);
-    static void AddEndMatches(OpSegment* seg, OpSegment* opp);
+    static void AddEndMatches(OpSegment* seg, OpSegment* opp, bool endsApart);
+    static void AddEndSect(OpSegment* seg, OpSegment* opp, OpPoint pt, float segT, float oppT
+            OP_LINE_FILE_DEF(SectReason reason));
     static void AddLineCurveIntersection(OpSegment* opp, OpSegment* seg);
     void findCoincidences();
     static void FindCoincidences(OpContours* );  // new interface
 //    void findLineCoincidences();
-    FoundIntersections findIntersections();
+    FoundIntersections findIntersections(size_t& budget);
+    size_t nextOverlap(const OpRect& segBounds, size_t oppIndex) const;
 //    FoundIntersections findIntersectionsX();
 //    static FoundIntersections FindIntersections(OpContours* );  // new interface
     static IntersectResult LineCoincidence(OpSegment* seg, OpSegment* opp);
+    bool matchEnds(size_t& budget);
+    void setBounds(const OpSegment* );
+    void setMoved(const OpSegment* );
 
 #if OP_DEBUG_DUMP
     #include "OpDebugDeclarations.h"
 #endif
 
-    std::vector<OpSegment*> inX;
+    OpContours* contours;
+    OpArray<OpSegment*> inX;
+    // close bounds of inX as columns, in the same order, so that pairs are tested without
+    // reading the segments; a disabled segment's bounds are NaN, which intersect nothing
+    OpArray<float> lefts;
+    OpArray<float> tops;
+    OpArray<float> rights;
+    OpArray<float> bottoms;
+    // set if an end of inX moved after match ends swept ends; pairs of segments whose ends
+    // have not moved, and which are not in end matches, need no end checks
+    OpArray<uint8_t> moved;
+    OpArray<OpSegmentEnd> sweepEnds;  // ends sorted by x; released once swept
+    OpArray<OpEndMatch> endMatches;  // sorted in the order find intersections visits pairs
+    size_t sweepIndex;  // segment to resume gathering ends from when match ends is paused
+    size_t sweptEnd;  // end to resume the sweep from
+    size_t nextMatch;  // first end match not yet visited by find intersections
+    bool endsSorted;
+    bool endsSwept;
+    size_t segIndex;  // segment pair to resume from when find intersections is paused
+    size_t oppIndex;
 };
 
 #endif
@@ -0,0 +1,202 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef OpSimd_DEFINED
+#define OpSimd_DEFINED
+
+// Rect compares on four floats (left, top, right, bottom) at once, or on one side of four
+// rects at once; and arithmetic on two points at once, as x0, y0, x1, y1. The instruction set
+// is chosen at compile time; define OP_SIMD as zero to use scalar code everywhere. Each
+// function returns exactly what the scalar code it replaces returns, including when inputs
+// are NaN.
+#ifndef OP_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) \
+		|| defined(__aarch64__) || defined(_M_ARM64)
+#define OP_SIMD 1
+#else
+#define OP_SIMD 0
+#endif
+#endif
+
+#if OP_SIMD
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define OP_SIMD_NEON 1
+#else
+#include <emmintrin.h>
+#define OP_SIMD_SSE 1
+#endif
+#endif
+
+// !!! pairs (OpPair) are left scalar: two lanes cost a load and store round trip per op, and
+//     compilers already pair the scalar ops
+struct OpSimd {
+#if OP_SIMD_NEON
+	typedef float32x4_t Rect;
+
+	static Rect Load(const float* r) {
+		return vld1q_f32(r);
+	}
+
+	static void Store(float* r, Rect v) {
+		vst1q_f32(r, v);
+	}
+
+	// built in registers; storing the floats and loading them as a vector would stall the load
+	static Rect Set(float x, float y) {
+		float32x2_t xy = vset_lane_f32(y, vdup_n_f32(x), 1);
+		return vcombine_f32(xy, xy);
+	}
+
+	// std::min(a, b) is (b < a ? b : a); std::max(a, b) is (a < b ? b : a)
+	// not used by OpRect, whose scalar union measured faster; see speedSimd
+	static Rect Union(Rect a, Rect b) {
+		Rect mins = vbslq_f32(vcltq_f32(b, a), b, a);
+		Rect maxs = vbslq_f32(vcltq_f32(a, b), b, a);
+		return vcombine_f32(vget_low_f32(mins), vget_high_f32(maxs));
+	}
+
+	// lefts and tops of b and a, against rights and bottoms of a and b
+	static bool AllLessOrEqual(Rect a, Rect b) {
+		Rect lt = vcombine_f32(vget_low_f32(b), vget_low_f32(a));
+		Rect rb = vcombine_f32(vget_high_f32(a), vget_high_f32(b));
+		return 0 != vminvq_u32(vcleq_f32(lt, rb));
+	}
+
+	static bool AllLess(Rect a, Rect b) {
+		Rect lt = vcombine_f32(vget_low_f32(b), vget_low_f32(a));
+		Rect rb = vcombine_f32(vget_high_f32(a), vget_high_f32(b));
+		return 0 != vminvq_u32(vcltq_f32(lt, rb));
+	}
+
+	static int Mask(uint32x4_t m) {
+		const uint32_t bits[4] = { 1, 2, 4, 8 };
+		return (int) vaddvq_u32(vandq_u32(m, vld1q_u32(bits)));
+	}
+
+	// see the SSE version below
+	static int Intersects4(const float* r, const float* lefts, const float* tops,
+			const float* rights, const float* bottoms, int* beyond) {
+		Rect l = vld1q_f32(lefts);
+		Rect rRight = vdupq_n_f32(r[2]);
+		uint32x4_t in = vandq_u32(vandq_u32(vcleq_f32(l, rRight), 
+				vcleq_f32(vdupq_n_f32(r[0]), vld1q_f32(rights))),
+				vandq_u32(vcleq_f32(vld1q_f32(tops), vdupq_n_f32(r[3])), 
+				vcleq_f32(vdupq_n_f32(r[1]), vld1q_f32(bottoms))));
+		*beyond = Mask(vcltq_f32(rRight, l));
+		return Mask(in);
+	}
+
+	static Rect Splat(float v) {
+		return vdupq_n_f32(v);
+	}
+
+	// a in the first two lanes, b in the last two
+	static Rect Spread(float a, float b) {
+		return vcombine_f32(vdup_n_f32(a), vdup_n_f32(b));
+	}
+
+	static Rect Add(Rect a, Rect b) {
+		return vaddq_f32(a, b);
+	}
+
+	static Rect Sub(Rect a, Rect b) {
+		return vsubq_f32(a, b);
+	}
+
+	static Rect Mul(Rect a, Rect b) {
+		return vmulq_f32(a, b);
+	}
+
+	static Rect Div(Rect a, Rect b) {
+		return vdivq_f32(a, b);
+	}
+#elif OP_SIMD_SSE
+	typedef __m128 Rect;
+
+	static Rect Load(const float* r) {
+		return _mm_loadu_ps(r);
+	}
+
+	static void Store(float* r, Rect v) {
+		_mm_storeu_ps(r, v);
+	}
+
+	static Rect Set(float x, float y) {
+		return _mm_setr_ps(x, y, x, y);
+	}
+
+	// min and max return their second argument if either is NaN, matching std::min(a, b)
+	// and std::max(a, b) with the arguments swapped
+	// not used by OpRect, whose scalar union measured faster; see speedSimd
+	static Rect Union(Rect a, Rect b) {
+		Rect mins = _mm_min_ps(b, a);
+		Rect maxs = _mm_max_ps(b, a);
+		return _mm_shuffle_ps(mins, maxs, _MM_SHUFFLE(3, 2, 1, 0));
+	}
+
+	// lefts and tops of b and a, against rights and bottoms of a and b
+	static bool AllLessOrEqual(Rect a, Rect b) {
+		return 0xF == _mm_movemask_ps(_mm_cmple_ps(_mm_movelh_ps(b, a), _mm_movehl_ps(b, a)));
+	}
+
+	static bool AllLess(Rect a, Rect b) {
+		return 0xF == _mm_movemask_ps(_mm_cmplt_ps(_mm_movelh_ps(b, a), _mm_movehl_ps(b, a)));
+	}
+
+	// Compares rect r (left, top, right, bottom) with four rects stored as columns. Returns a
+	// bit for each rect that intersects r, as OpRect::intersects does, and sets beyond to a
+	// bit for each rect whose left is greater than r's right. NaN intersects nothing.
+	static int Intersects4(const float* r, const float* lefts, const float* tops,
+			const float* rights, const float* bottoms, int* beyond) {
+		Rect l = _mm_loadu_ps(lefts);
+		Rect rRight = _mm_set1_ps(r[2]);
+		Rect in = _mm_and_ps(_mm_and_ps(_mm_cmple_ps(l, rRight), 
+				_mm_cmple_ps(_mm_set1_ps(r[0]), _mm_loadu_ps(rights))),
+				_mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(tops), _mm_set1_ps(r[3])), 
+				_mm_cmple_ps(_mm_set1_ps(r[1]), _mm_loadu_ps(bottoms))));
+		*beyond = _mm_movemask_ps(_mm_cmplt_ps(rRight, l));
+		return _mm_movemask_ps(in);
+	}
+
+	static Rect Splat(float v) {
+		return _mm_set1_ps(v);
+	}
+
+	// a in the first two lanes, b in the last two
+	static Rect Spread(float a, float b) {
+		return _mm_setr_ps(a, a, b, b);
+	}
+
+	static Rect Add(Rect a, Rect b) {
+		return _mm_add_ps(a, b);
+	}
+
+	static Rect Sub(Rect a, Rect b) {
+		return _mm_sub_ps(a, b);
+	}
+
+	static Rect Mul(Rect a, Rect b) {
+		return _mm_mul_ps(a, b);
+	}
+
+	static Rect Div(Rect a, Rect b) {
+		return _mm_div_ps(a, b);
+	}
+#endif
+#if OP_SIMD
+	// Stores the points at t[0] and t[1] as x0, y0, x1, y1. Point at t returns the curve's ends
+	// as is for t of zero and one, so those are stored in place of the computed points.
+	static void StorePair(float* pts, Rect v, const float* t, const float* start, 
+			const float* end) {
+		Store(pts, v);
+		for (int index = 0; index < 2; ++index) {
+			const float* exact = 0 == t[index] ? start : 1 == t[index] ? end : nullptr;
+			if (exact) {
+				pts[index * 2] = exact[0];
+				pts[index * 2 + 1] = exact[1];
+			}
+		}
+	}
+#endif
+};
+
+#endif
@@ -274,8 +274,8 @@ struct OpTightBounds : OpPointBounds {
         return true;
     }
     
-    std::vector<ExtremaT> findExtrema(OpPoint start, OpPoint end) {
-        std::vector<ExtremaT> selfPtTs;
+    OpArray<ExtremaT> findExtrema(OpPoint start, OpPoint end) {
+        OpArray<ExtremaT> selfPtTs;
         for (size_t index = 0; index < ARRAY_COUNT(xExtrema); ++index) {
             if (OpMath::IsNaN(xExtrema[index].t))
                 break;
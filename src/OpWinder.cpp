@@ -136,7 +136,7 @@ FindCept SectRay::findIntercept(OpEdge* test) {
 	// !!! EXPERIMENT
 	// try using segment's curve instead of edge curve
 	// edge curve's control points, especially small ones, may magnify error
-	OpRoots roots = test->curve.axisRayHit(axis, normal);
+	OpRoots roots = test->curve().axisRayHit(axis, normal);
 	// get the normal at the intersect point and see if it is usable
 	if (1 < roots.count) {
 		return FindCept::retry;  // preferable for thread_cubics157381
@@ -155,7 +155,7 @@ FindCept SectRay::findIntercept(OpEdge* test) {
 	if (OpMath::IsNaN(root) || 0 == root || root == 1)
 		return FindCept::retry;
 #endif
-	OpVector tangent = test->curve.tangent(root).normalize();
+	OpVector tangent = test->curve().tangent(root).normalize();
 	if (!tangent.isFinite() || tangent == OpVector{ 0, 0 } )
 		return FindCept::retry;
 	OpVector ray = Axis::horizontal == axis ? OpVector{ 1, 0 } : OpVector{ 0, 1 };
@@ -163,7 +163,7 @@ FindCept SectRay::findIntercept(OpEdge* test) {
 	float tNxR = tangent.cross(backRay);
 	if (fabs(tNxR) < WINDING_NORMAL_LIMIT)
 		return FindCept::retry;
-	OpPoint pt = test->curve.ptAtT(root);
+	OpPoint pt = test->curve().ptAtT(root);
 	Axis perpendicular = !axis;
 	float testXY = pt.choice(perpendicular);
 	bool reversed = tangent.dot(homeTangent) < 0;
@@ -187,13 +187,21 @@ OpWinder::OpWinder(OpContours& contours, EdgesToSort edgesToSort) {
 		}
 	}
 	sort(edgesToSort);
+	home = nullptr;
 	workingAxis = Axis::neither;
+	chainAxis = Axis::horizontal;
+	chainIndex = 0;
+	sizeIndex = 0;
 }
 
 OpWinder::OpWinder(OpEdge* sEdge, OpEdge* oEdge) {
 	addEdge(sEdge, EdgesToSort::byCenter);
 	addEdge(oEdge, EdgesToSort::byCenter);
+	home = nullptr;
 	workingAxis = Axis::neither;
+	chainAxis = Axis::horizontal;
+	chainIndex = 0;
+	sizeIndex = 0;
 }
 
 void OpWinder::addEdge(OpEdge* edge, EdgesToSort edgesToSort) {
@@ -304,10 +312,10 @@ void OpWinder::AddMix(XyChoice xyChoice, OpPtT ptTAorB, bool flipped, OpPtT cPtT
 IntersectResult OpWinder::AddPair(XyChoice xyChoice, OpPtT aPtT, OpPtT bPtT, OpPtT cPtT, OpPtT dPtT,
 	bool flipped, OpSegment* segment, OpSegment* oppSegment) {
 	// set range to contain intersections that match this segment and opposite segment
-	std::vector<OpIntersection*> range;
+	OpArray<OpIntersection*> range;
 	segment->sects.range(oppSegment, range);
 	// return existing intersection that matches segment coincident ends
-	auto findSect = [](const std::vector<OpIntersection*>& range, OpPtT ptT) {	// lambda
+	auto findSect = [](const OpArray<OpIntersection*>& range, OpPtT ptT) {	// lambda
 		for (auto entry : range) {
 			if (entry->ptT.t == ptT.t || entry->ptT.pt == ptT.pt)
 				return entry;
@@ -317,7 +325,7 @@ IntersectResult OpWinder::AddPair(XyChoice xyChoice, OpPtT aPtT, OpPtT bPtT, OpP
 	// returns index into existing coincidence pairs. Even is outside pair, odd is inside pair.
 	// !!! note the return allows us to know if pair of calls to in coin range encompasses one or
 	//     more pairs, but we don't take advantage of that yet
-	auto inCoinRange = [](const std::vector<OpIntersection*>& range, float t, int* coinID) {
+	auto inCoinRange = [](const OpArray<OpIntersection*>& range, float t, int* coinID) {
 		OpIntersection* coinStart = nullptr;
 		int index = 0;
 		for (auto entry : range) {
@@ -387,7 +395,7 @@ IntersectResult OpWinder::AddPair(XyChoice xyChoice, OpPtT aPtT, OpPtT bPtT, OpP
 			addedSect2 = !!sect2;
 		}
 	}
-	std::vector<OpIntersection*> oRange;
+	OpArray<OpIntersection*> oRange;
 	oppSegment->sects.range(segment, oRange);
 	OpIntersection* oSect1 = findSect(oRange, { aPtT.pt, -1 });
 	OpIntersection* oSect2 = findSect(oRange, { bPtT.pt, -1 });
@@ -451,7 +459,7 @@ IntersectResult OpWinder::AddPair(XyChoice xyChoice, OpPtT aPtT, OpPtT bPtT, OpP
 		oppSegment->sects.resort = true;
 	}
 	if (addToExistingRange) {
-		auto coinOutside = [](std::vector<OpIntersection*>& range, 
+		auto coinOutside = [](OpArray<OpIntersection*>& range, 
 				bool addedSect1, OpIntersection* sect1, bool addedSect2, OpIntersection* sect2) {
 			if (addedSect1 || addedSect2) {
 				if (addedSect1)
@@ -598,12 +606,12 @@ FoundIntercept OpWinder::findRayIntercept(size_t homeIndex, OpVector homeTan, fl
 	Axis perpendicular = !workingAxis;
 	float mid = .5;
 	float midEnd = .5;
-	std::vector<OpEdge*>& inArray = Axis::horizontal == workingAxis ? inX : inY;
+	OpArray<OpEdge*>& inArray = Axis::horizontal == workingAxis ? inX : inY;
 	ray.homeT = OpMath::Interp(home->start.t, home->end.t, home->center.t);
 	// if find intercept fails, retry some number of times
 	// if all retries fail, distinguish between failure cases
 	//   if it failed because closest edge was too close, mark pair as unsectable
-	std::vector<EdgeDistance> touching;
+	OpArray<EdgeDistance> touching;
 	do {
 		// !!! restructure this slightly to break out to try a different center when touching is
 		// pushed back, unless it's the last go round; then, find all ray intersections before
@@ -642,11 +650,12 @@ FoundIntercept OpWinder::findRayIntercept(size_t homeIndex, OpVector homeTan, fl
 		if (ray.checkOrder(home))
 			return FoundIntercept::yes;
 	tryADifferentCenter:
+		++home->contours()->counts.rayRetries;
 		mid /= 2;
 		midEnd = midEnd < .5 ? 1 - mid : mid;
 		float middle = OpMath::Interp(home->ptBounds.ltChoice(workingAxis), 
 				home->ptBounds.rbChoice(workingAxis), midEnd);
-		float homeMidT = home->curve.center(workingAxis, middle);  // note: 0 to 1 on edge curve
+		float homeMidT = home->curve().center(workingAxis, middle);  // note: 0 to 1 on edge curve
 		if (OpMath::IsNaN(homeMidT) || mid <= 1.f / 256.f) {  // give it at most eight tries
 			// look for the same edge touching multiple times; the pair are unsectable
 			if (FindCept::unsectable == findCept) {
@@ -668,9 +677,9 @@ FoundIntercept OpWinder::findRayIntercept(size_t homeIndex, OpVector homeTan, fl
 			break;	// give up
 		}
 		// if find ray intercept can't find, restart with new center, normal, distance, etc.
-		ray.homeCept = homeCept = home->curve.ptAtT(homeMidT).choice(perpendicular);
+		ray.homeCept = homeCept = home->curve().ptAtT(homeMidT).choice(perpendicular);
 		OP_ASSERT(!OpMath::IsNaN(homeCept));
-		ray.normal = normal = home->curve.ptAtT(homeMidT).choice(workingAxis);
+		ray.normal = normal = home->curve().ptAtT(homeMidT).choice(workingAxis);
 		ray.homeT = homeMidT;
 		OP_ASSERT(!OpMath::IsNaN(normal));
 	} while (true);
@@ -685,7 +694,7 @@ void OpWinder::markUnsortable() {
 	home->rayFail = Axis::vertical == workingAxis ? EdgeFail::vertical : EdgeFail::horizontal;
 }
 
-size_t OpWinder::setInIndex(size_t homeIndex, float homeCept, std::vector<OpEdge*>& inArray) {
+size_t OpWinder::setInIndex(size_t homeIndex, float homeCept, OpArray<OpEdge*>& inArray) {
 	Axis perpendicular = !workingAxis;
 	// advance to furthest that could influence the sum winding of this edge
 	size_t inIndex = homeIndex + 1;
@@ -700,7 +709,7 @@ size_t OpWinder::setInIndex(size_t homeIndex, float homeCept, std::vector<OpEdge
 // if horizontal axis, look at rect top/bottom
 ChainFail OpWinder::setSumChain(size_t homeIndex) {
 	// see if normal at center point is in direction of ray
-	std::vector<OpEdge*>& inArray = Axis::horizontal == workingAxis ? inX : inY;
+	OpArray<OpEdge*>& inArray = Axis::horizontal == workingAxis ? inX : inY;
 	home = inArray[homeIndex];
 	OP_ASSERT(!home->disabled);
 	const OpSegment* edgeSeg = home->segment;
@@ -866,13 +875,17 @@ ResolveWinding OpWinder::setWindingByDistance(OpContours* contours) {
 	return ResolveWinding::resolved;	   // (will copy many to winding after all many are found)
 }
 
-FoundWindings OpWinder::setWindings(OpContours* contours) {
+// each edge checked uses one unit of budget; returns paused if budget runs out
+FoundWindings OpWinder::setSumChains(OpContours* contours, size_t& budget) {
 	// test sum chain for correctness; recompute if prior or next are inconsistent
-	for (Axis a : { Axis::horizontal, Axis::vertical }) {
-		workingAxis = a;
-		std::vector<OpEdge*>& edges = Axis::horizontal == workingAxis ? inX : inY;
-		for (size_t index = 0; index < edges.size(); ++index) {
-			home = edges[index];
+	for (; Axis::neither != chainAxis; chainAxis = Axis::horizontal == chainAxis 
+			? Axis::vertical : Axis::neither, chainIndex = 0) {
+		workingAxis = chainAxis;
+		OpArray<OpEdge*>& edges = Axis::horizontal == workingAxis ? inX : inY;
+		for (; chainIndex < edges.size(); ++chainIndex) {
+			if (contours->stopStep(budget))
+				return FoundWindings::paused;
+			home = edges[chainIndex];
 			if (home->ray.distances.size() && EdgeFail::none == home->rayFail)
 				continue;
 			if (home->disabled)	// may not be visible in vertical pass
@@ -885,11 +898,16 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 				home->rayFail = EdgeFail::none;
 			else if (home->isUnsortable)  // may be too small
 				continue;
-			ChainFail chainFail = setSumChain(index);
+			ChainFail chainFail = setSumChain(chainIndex);
 			if (ChainFail::normalizeOverflow == chainFail)
 				OP_DEBUG_FAIL(*home, FoundWindings::fail);
 		}
 	}
+	return FoundWindings::yes;
+}
+
+// after sum chains are set, gather pals and sort edges by size for set windings
+void OpWinder::addPals(OpContours* contours) {
 	for (auto contour : contours->contours) {
 		for (auto& segment : contour->segments) {
 			for (auto& edge : segment.edges) {
@@ -910,11 +928,11 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 		for (auto& segment : contour->segments) {
 			for (auto& edge : segment.edges) {
 					// copy pals if reciprocal, and points to other pals (thread_cubics2247347)
-				std::vector<EdgeDistance>& pals = edge.pals;
-				std::vector<EdgeDistance*> reciprocals;
+				auto& pals = edge.pals;
+				OpArray<EdgeDistance*> reciprocals;
 				for (EdgeDistance& pal : pals) {
 					bool foundReciprocal = false;
-					std::vector<EdgeDistance*> locals;
+					OpArray<EdgeDistance*> locals;
 					for (EdgeDistance& oPal : pal.edge->pals) {
 						if (oPal.edge == &edge) {
 							foundReciprocal = true;
@@ -941,7 +959,6 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 	}
 
 	// sort edges so that largest edges' winding sums are computed first
-	std::vector<OpEdge*> bySize;
 	for (auto contour : contours->contours) {
 		for (auto& segment : contour->segments) {
 			for (auto& edge : segment.edges) {
@@ -963,7 +980,7 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 						OpEdge* neighbor = edge.segment->findEnabled(ptT, match);
 						if (!neighbor->unsectableID)
 							return 0;
-						std::vector<EdgeDistance>& nDists = neighbor->ray.distances;
+						OpArray<EdgeDistance>& nDists = neighbor->ray.distances;
 						auto palIter = std::find_if(nDists.begin(), nDists.end(), [&neighbor, &edge]
 								(const EdgeDistance& dist) {
 							if (dist.edge == neighbor)
@@ -972,7 +989,7 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 								return false;
 							if (!dist.edge->unsectableID)
 								return false;
-							std::vector<EdgeDistance>& eDists = edge.ray.distances;
+							OpArray<EdgeDistance>& eDists = edge.ray.distances;
 							return eDists.end() != std::find_if(eDists.begin(), eDists.end(), 
 									[&dist](const EdgeDistance& eDist) {
 								return eDist.edge == dist.edge;
@@ -998,14 +1015,27 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 	std::sort(bySize.begin(), bySize.end(), [](const auto& s1, const auto& s2) {
 		return s1->ptBounds.perimeter() > s2->ptBounds.perimeter(); 
 	} );
-	for (auto edge : bySize) {
+}
+
+// sum chains and windings by distance use one unit of budget per edge
+FoundWindings OpWinder::setWindings(OpContours* contours, size_t& budget) {
+	if (Axis::neither != chainAxis) {
+		FoundWindings chained = setSumChains(contours, budget);
+		if (FoundWindings::yes != chained)
+			return chained;
+		addPals(contours);
+	}
+	for (; sizeIndex < bySize.size(); ++sizeIndex) {
+		if (contours->stopStep(budget))
+			return FoundWindings::paused;
+		OpEdge* edge = bySize[sizeIndex];
 		if (edge->sum.isSet())
 			continue;
 		home = edge;
 		ResolveWinding resolveWinding = setWindingByDistance(contours);
 		if (ResolveWinding::retry == resolveWinding) {
 			workingAxis = home->ray.axis;
-			std::vector<OpEdge*>& edges = Axis::horizontal == workingAxis ? inX : inY;
+			OpArray<OpEdge*>& edges = Axis::horizontal == workingAxis ? inX : inY;
 			auto found = std::find(edges.begin(), edges.end(), home);
 			OP_ASSERT(edges.end() != found);
 			size_t index = found - edges.begin();
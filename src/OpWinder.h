@@ -24,6 +24,7 @@ enum class EdgesToSort {
 
 enum class FoundIntersections {
 	fail,
+	paused,  // budget ran out; call again to resume
 	yes
 };
 
@@ -36,6 +37,7 @@ enum class FoundIntercept {
 
 enum class FoundWindings {
 	fail,
+	paused,  // budget ran out; call again to resume
 	yes
 };
 
@@ -43,6 +45,7 @@ struct OpWinder {
 	OpWinder(OpContours& contours, EdgesToSort edgesToSort);
 	OpWinder(OpEdge* sEdge, OpEdge* oEdge);
 	void addEdge(OpEdge* , EdgesToSort );
+	void addPals(OpContours* );
 	static IntersectResult AddLineCurveIntersection(OpEdge& opp, OpEdge& edge, 
 			bool secondAttempt = false);
 	static void AddMix(XyChoice xyChoice, OpPtT ptTAorB, bool flipped, OpPtT cPtT, OpPtT dPtT,
@@ -54,10 +57,11 @@ struct OpWinder {
 	static IntersectResult CoincidentCheck(const OpEdge& edge, const OpEdge& opp);
 	FoundIntercept findRayIntercept(size_t inIndex, OpVector tangent, float normal, float homeCept);
 	void markUnsortable();
-	size_t setInIndex(size_t homeIndex, float homeCept, std::vector<OpEdge*>& inArray);
+	size_t setInIndex(size_t homeIndex, float homeCept, OpArray<OpEdge*>& inArray);
 	ChainFail setSumChain(size_t inIndex);
+	FoundWindings setSumChains(OpContours* , size_t& budget);
 	ResolveWinding setWindingByDistance(OpContours* );
-	FoundWindings setWindings(OpContours* );
+	FoundWindings setWindings(OpContours* , size_t& budget);
 	void sort(EdgesToSort);
 
 #if OP_DEBUG_VALIDATE
@@ -71,10 +75,14 @@ struct OpWinder {
 	void debugDraw();
 #endif
 
-	std::vector<OpEdge*> inX;
-	std::vector<OpEdge*> inY;
+	OpArray<OpEdge*> inX;
+	OpArray<OpEdge*> inY;
+	OpArray<OpEdge*> bySize;  // edges with rays, largest first
 	OpEdge* home;
 	Axis workingAxis;
+	Axis chainAxis;  // set sum chain progress, kept so set windings can resume
+	size_t chainIndex;
+	size_t sizeIndex;
 };
 
 #endif
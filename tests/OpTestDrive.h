@@ -11,6 +11,7 @@
 #define TEST_PATH_OP_SKIP_TO_FILE "quadralateral" // e.g., "quad" tests only (see testSuites in OpSkiaTests)
 
 #define OP_DEBUG_RECORD 0  // track some statistic or other while running 
+#define OP_SPEED_TEST 0  // set to one to print SIMD and scalar timings from the new interface tests
 #define OP_DEBUG_VERBOSE (1 && !OP_DEBUG_FAST_TEST)
 #define OP_RELEASE_TEST 1	// !!! set to zero to remove tests from release build (untested)
 
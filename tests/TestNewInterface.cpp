@@ -5,21 +5,33 @@ namespace PathOpsV0Lib {    // !!! move to new PathOps.h
 void Add(AddCurve , AddWinding );
 }
 
+#include "curves/ConicBezier.h"
+#include "curves/CubicBezier.h"
 #include "curves/Line.h"
 #include "curves/NoCurve.h"
 #include "curves/QuadBezier.h"
 #include "curves/UnaryWinding.h"
 
 #include "PathOps.h"
+#include "OpArena.h"
+#include <algorithm>
+#include <thread>
 
 // curve types
 OpType lineType = OpType::no;  // unset
 OpType quadType = OpType::no;
 
+// appends to output string if there is one, and writes to the debug console if not
 void commonOutput(PathOpsV0Lib::Curve c, OpType type, bool firstPt, bool lastPt, 
         PathOpsV0Lib::PathOutput output) {
+    auto write = [output](std::string str) {
+        if (output)
+            *(std::string*) output += str;
+        else
+            OpDebugOut(str);
+    };
     if (firstPt)
-        OpDebugOut("contour start --\n");
+        write("contour start --\n");
     std::string outStr = lineType == type ? "line: " : "quad: ";
     auto addPtStr = [&outStr](const OpPoint& pt, std::string delimiter) {
         outStr += "{ " + std::to_string(pt.x) + ", " + std::to_string(pt.y) + " }" + delimiter;
@@ -28,9 +40,9 @@ void commonOutput(PathOpsV0Lib::Curve c, OpType type, bool firstPt, bool lastPt,
     if (quadType == type)
         addPtStr(quadControlPt(c), ", ");
     addPtStr(c.data->end, "\n");
-    OpDebugOut(outStr);
+    write(outStr);
     if (lastPt)
-        OpDebugOut("-- contour end\n");
+        write("-- contour end\n");
 }
 
 void lineOutput(PathOpsV0Lib::Curve c, bool firstPt, bool lastPt, 
@@ -46,10 +58,23 @@ void quadOutput(PathOpsV0Lib::Curve c, bool firstPt, bool lastPt,
 void noEmptyPath(PathOpsV0Lib::PathOutput ) {
 }
 
-void testNewInterface() {
-    using namespace PathOpsV0Lib;
+void appendOutputDone(PathOpsV0Lib::PathOutput output) {
+    *(std::string*) output += "output done\n";
+}
 
-    Context* context = CreateContext({nullptr, 0});
+using namespace PathOpsV0Lib;
+
+static void check(bool success, std::string testname) {
+    if (!success) {
+        OpDebugOut(testname + " failed\n");
+        exit(1);
+    }
+}
+
+// context is created here if not passed
+static Context* createTestContext(Context* context = nullptr) {
+    if (!context)
+        context = CreateContext({nullptr, 0});
     SetContextCallBacks(context, noEmptyPath);
 
 #if OP_DEBUG
@@ -74,9 +99,10 @@ void testNewInterface() {
             OP_DEBUG_DUMP_PARAMS(noDumpCurveExtra)
             OP_DEBUG_IMAGE_PARAMS(noAddToSkPathFunc)
     );
+    return context;
+}
 
-    // example: given points describing a pair of closed loops with quadratic Beziers, find
-    //          their intersection
+static Contour* createTestContour(Context* context) {
     Contour* contour = CreateContour({context, nullptr, 0});
     SetWindingCallBacks(contour, unaryWindingAddFunc, unaryWindingKeepFunc, 
             unaryWindingSubtractFunc, unaryWindingVisibleFunc, unaryWindingZeroFunc 
@@ -84,6 +110,12 @@ void testNewInterface() {
             OP_DEBUG_IMAGE_PARAMS(noWindingImageOutFunc, noNativePathFunc,
                     noDebugGetDrawFunc, noDebugSetDrawFunc, noIsOppFunc)
     );
+    return contour;
+}
+
+// example: given points describing a pair of closed loops with quadratic Beziers, find
+//          their intersection
+static void addExample(Contour* contour) {
     int windingData[] = { 1 };
     AddWinding addWinding { contour, windingData, sizeof(windingData) };
     constexpr size_t lineSize = sizeof(OpPoint) * 2;
@@ -108,11 +140,1022 @@ void testNewInterface() {
     Add(     { &contour2[0], lineSize, lineType }, addWinding );
     AddQuads({ &contour2[1], quadSize, quadType }, addWinding );
     Add(     { &contour2[4], lineSize, lineType }, addWinding );
+}
+
+// adds the rectangle as four lines, clockwise; swap top and bottom to add it counterclockwise
+static void addRect(Contour* contour, float left, float top, float right, float bottom) {
+    int windingData[] = { 1 };
+    AddWinding addWinding { contour, windingData, sizeof(windingData) };
+    OpPoint pts[] { { left, top }, { right, top }, { right, bottom }, { left, bottom },
+            { left, top } };
+    for (int index = 0; index < 4; ++index)
+        Add({ &pts[index], sizeof(OpPoint) * 2, lineType }, addWinding );
+}
+
+static void measured(PathOutput output, const OutputMeasures& measures) {
+    *(OutputMeasures*) output = measures;
+}
+
+// a second resolve of the same context starts over, and produces the same output
+static void testResolveTwice() {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string first, second;
+    Resolve(context, &first);
+    Resolve(context, &second);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && first.size() && first == second, "resolve twice");
+}
+
+// resolve async matches resolve; delete context stops a resolve async still running
+static void testResolveAsync() {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string expected, output;
+    Resolve(context, &expected);
+    std::future<ContextError> result = ResolveAsync(context, &output, nullptr);
+    check(ContextError::none == result.get() && output == expected, "resolve async");
+    (void) ResolveAsync(context, &output, nullptr);
+    DeleteContext(context);
+}
+
+static void deleteOnComplete(Context* context, PathOutput , ContextError ) {
+    DeleteContext(context);
+}
+
+// the completion callback may delete the context, however soon the resolve finishes; a second
+// resolve async cancels the first, and outputs what resolve does
+static void testResolveAsyncDelete() {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string expected;
+    Resolve(context, &expected);
+    bool ok = true;
+    for (int loop = 0; loop < 20; ++loop) {
+        Context* deleted = createTestContext();
+        addExample(createTestContour(deleted));
+        std::string output;
+        ok &= ContextError::none == ResolveAsync(deleted, &output, deleteOnComplete).get() 
+                && output == expected;
+    }
+    std::string first, second;
+    std::future<ContextError> firstResult = ResolveAsync(context, &first, nullptr);
+    std::future<ContextError> secondResult = ResolveAsync(context, &second, nullptr);
+    ContextError firstError = firstResult.get();
+    ok &= ContextError::none == secondResult.get() && second == expected
+            && (ContextError::cancelled == firstError || ContextError::none == firstError);
+    DeleteContext(context);
+    check(ok, "resolve async delete");
+}
+
+// output done is called once, after the last contour
+static void testOutputDone() {
+    Context* context = createTestContext();
+    SetOutputDone(context, appendOutputDone);
+    addExample(createTestContour(context));
+    std::string output;
+    Resolve(context, &output);
+    DeleteContext(context);
+    std::string done = "output done\n";
+    check(output.size() > done.size() && output.find(done) == output.size() - done.size(),
+            "output done");
+}
+
+// coverage is zero in a hole, whichever way the hole's output contour turns: the windings of
+// the clockwise and counterclockwise rectangles cancel where they overlap
+static void testCoverageHole() {
+    Context* context = createTestContext();
+    Contour* contour = createTestContour(context);
+    addRect(contour, 1, 1, 11, 16);
+    addRect(contour, 6, 12, 12, 8);
+    uint8_t pixels[16 * 16];
+    SetCoverageOutput(context, { pixels, 16, 16, 16, 1, 0, 0, 0, 1, 0 });
+    Resolve(context, nullptr);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    auto at = [&pixels](int x, int y) { return pixels[y * 16 + x]; };
+    check(ContextError::none == error && 0 == at(8, 10) && 255 == at(3, 10) 
+            && 255 == at(11, 10) && 255 == at(8, 4) && 0 == at(13, 10) && 0 == at(0, 0),
+            "coverage hole");
+}
+
+// contains is false in a hole, whichever way the hole's output contour turns; contains winding
+// of an island in a hole matches that of the contour enclosing the hole
+static void testContainsHole() {
+    Context* context = createTestContext();
+    Contour* contour = createTestContour(context);
+    addRect(contour, 1, 1, 11, 16);
+    addRect(contour, 6, 12, 12, 8);
+    std::string output;
+    Resolve(context, &output);
+    OpPoint pts[] { { 8, 10 }, { 3, 10 }, { 11.5f, 10 }, { 13, 10 } };
+    bool inside[4];
+    Contains(context, pts, 4, inside);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && !inside[0] && inside[1] && inside[2] && !inside[3],
+            "contains hole");
+    context = createTestContext();
+    contour = createTestContour(context);
+    addRect(contour, 0, 0, 10, 3);  // frame
+    addRect(contour, 0, 7, 10, 10);
+    addRect(contour, 0, 0, 3, 10);
+    addRect(contour, 7, 0, 10, 10);
+    addRect(contour, 4, 4, 6, 6);  // island
+    Resolve(context, &output);
+    OpPoint framePts[] { { 1, 1 }, { 3.5f, 5 }, { 5, 5 }, { 11, 5 } };
+    int windings[4];
+    ContainsWinding(context, framePts, 4, windings);
+    error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && windings[0] && !windings[1] 
+            && windings[2] == windings[0] && !windings[3], "contains winding island");
+}
+
+struct Nested {
+    int parent;
+    int depth;
+};
+
+static std::vector<Nested> nestedContours;
+
+static void recordNesting(PathOutput , int contour, int parent, int depth) {
+    if ((int) nestedContours.size() <= contour)
+        nestedContours.resize(contour + 1, { -2, -2 });
+    nestedContours[contour] = { parent, depth };
+}
+
+// each contour's parent is one shallower than the contour, and depths match those expected
+static bool checkNesting(std::vector<int> expected) {
+    std::vector<int> depths;
+    for (const Nested& nested : nestedContours) {
+        int parentDepth = nested.parent < 0 ? -1 : nested.parent < (int) nestedContours.size()
+                ? nestedContours[nested.parent].depth : -2;
+        if (parentDepth != nested.depth - 1)
+            return false;
+        depths.push_back(nested.depth);
+    }
+    std::sort(depths.begin(), depths.end());
+    return expected == depths;
+}
+
+// rings nested in rings report increasing depth; holes side by side share their parent
+static void testNesting() {
+    Context* context = createTestContext();
+    SetContourNesting(context, recordNesting);
+    Contour* contour = createTestContour(context);
+    addRect(contour, 0, 0, 20, 20);
+    addRect(contour, 4, 16, 16, 4);
+    addRect(contour, 6, 6, 14, 14);
+    addRect(contour, 8, 12, 12, 8);
+    std::string output;
+    nestedContours.clear();
+    Resolve(context, &output);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && checkNesting({ 0, 1, 2, 3 }), "nesting rings");
+    context = createTestContext();
+    SetContourNesting(context, recordNesting);
+    contour = createTestContour(context);
+    addRect(contour, 0, 0, 20, 20);
+    addRect(contour, 2, 8, 8, 2);
+    addRect(contour, 12, 18, 18, 12);
+    nestedContours.clear();
+    Resolve(context, &output);
+    error = Error(context);
+    DeleteContext(context);
+    bool sameParent = 3 == nestedContours.size();
+    for (const Nested& nested : nestedContours) {
+        if (1 == nested.depth)
+            sameParent &= 0 == nestedContours[nested.parent].depth;
+    }
+    check(ContextError::none == error && checkNesting({ 0, 1, 1 }) && sameParent,
+            "nesting disjoint holes");
+}
+
+// resolve steps with any budget output what resolve does; a step after the last one starts over
+static void testResolveStep() {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string expected;
+    Resolve(context, &expected);
+    bool ok = true;
+    for (size_t budget : { 1, 2, 3, 7, 50 }) {
+        std::string output;
+        int calls = 1;
+        while (!ResolveStep(context, &output, budget) && calls < 100000)
+            ++calls;
+        ok &= ContextError::none == Error(context) && output == expected 
+                && (budget > 1 || calls > 1);
+        output.clear();
+        ok &= ResolveStep(context, &output, OpMax) && output == expected;  // restart after done
+    }
+    DeleteContext(context);
+    check(ok, "resolve step");
+}
+
+// adds a square and a shape with lines and a quad whose first point is nearly the square's
+// corner; snapping that point to the corner moves the lines and quad that cross the square
+static void addNearCorner(Contour* contour, float cornerX) {
+    addRect(contour, 0, 0, 10, 10);
+    int windingData[] = { 1 };
+    AddWinding addWinding { contour, windingData, sizeof(windingData) };
+    OpPoint pts[] { { cornerX, 10 }, { 14, 4 }, { 4, 14 }, { cornerX, 10 }, { 6, 8 } };
+    Add({ &pts[0], sizeof(OpPoint) * 2, lineType }, addWinding );
+    Add({ &pts[1], sizeof(OpPoint) * 2, lineType }, addWinding );
+    AddQuads({ &pts[2], sizeof(OpPoint) * 3, quadType }, addWinding );  // start, end, control
+}
+
+// an end snapped to a nearly equal end gives the area that equal ends do, and stepping
+// interleaves snaps and intersections as resolve does
+static void testEndSnap() {
+    const float tolerance = .001f;
+    OutputMeasures exact, near;
+    Context* context = createTestContext();
+    SetCurveArea(context, quadType, quadArea);
+    addNearCorner(createTestContour(context), 10);
+    SetMeasureOutput(context, measured, tolerance);
+    Resolve(context, &exact);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    context = createTestContext();
+    SetCurveArea(context, quadType, quadArea);
+    addNearCorner(createTestContour(context), OpMath::NextLarger(10));
+    std::string expected, output;
+    Resolve(context, &expected);
+    while (!ResolveStep(context, &output, 1))
+        ;
+    SetMeasureOutput(context, measured, tolerance);
+    Resolve(context, &near);
+    ContextError nearError = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && ContextError::none == nearError && output == expected
+            && exact.area > 100 && std::abs(exact.area - near.area) <= tolerance * exact.perimeter,
+            "end snap");
+}
+
+// a resolve stopped by a limit fails with the limit's error; the context may resolve again
+static void checkLimit(ContextLimits limits, ContextError limitError, std::string name) {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string expected, output;
+    Resolve(context, &expected);
+    SetContextLimits(context, limits);
+    Resolve(context, &output);
+    ContextError limited = Error(context);
+    SetContextLimits(context, {});
+    output.clear();
+    Resolve(context, &output);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(limitError == limited && ContextError::none == error && output == expected, name);
+}
+
+static void testLimits() {
+    checkLimit({ 1, 0, 0, 0, 0, 0 }, ContextError::segmentLimit, "segment limit");
+    checkLimit({ 0, 1, 0, 0, 0, 0 }, ContextError::edgeLimit, "edge limit");
+    checkLimit({ 0, 0, 1, 0, 0, 0 }, ContextError::curveCurveLimit, "curve curve limit");
+    checkLimit({ 0, 0, 0, 1, 0, 0 }, ContextError::limbLimit, "limb limit");
+    checkLimit({ 0, 0, 0, 0, 0, 1 }, ContextError::memoryLimit, "memory limit");
+}
+
+// time is checked when a step starts, so a step after the time limit has passed fails
+static void testTimeLimitAndCancel() {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string expected, output;
+    Resolve(context, &expected);
+    SetContextLimits(context, { 0, 0, 0, 0, 1, 0 });
+    bool stepped = !ResolveStep(context, &output, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    stepped &= ResolveStep(context, &output, OpMax);
+    ContextError timedOut = Error(context);
+    SetContextLimits(context, {});
+    Cancel(context);  // no resolve is running, so the next one is cancelled
+    output.clear();
+    Resolve(context, &output);
+    ContextError cancelled = Error(context);
+    output.clear();
+    stepped &= !ResolveStep(context, &output, 1);
+    Cancel(context);
+    stepped &= ResolveStep(context, &output, OpMax);
+    ContextError stepCancelled = Error(context);
+    output.clear();
+    Resolve(context, &output);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(stepped && ContextError::timeLimit == timedOut && ContextError::cancelled == cancelled
+            && ContextError::cancelled == stepCancelled && ContextError::none == error 
+            && output == expected, "time limit and cancel");
+}
+
+// allocates while user's count of allowed blocks lasts, then refuses
+static void* countedAllocate(void* user, size_t size) {
+    int& allowed = *(int*) user;
+    return allowed-- > 0 ? malloc(size) : nullptr;
+}
+
+static void countedFree(void* , void* block) {
+    free(block);
+}
+
+// a resolve whose memory is refused fails with memory limit; the context may resolve again
+static void testMemoryRefused() {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string expected, output;
+    Resolve(context, &expected);
+    int allowed = 1;
+    SetMemoryCallBacks(context, countedAllocate, countedFree, &allowed);
+    Resolve(context, &output);
+    ContextError refused = Error(context);
+    size_t overflow = Memory(context).overflow;
+    allowed = 1000000;
+    output.clear();
+    Resolve(context, &output);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(ContextError::memoryLimit == refused && ContextError::none == error 
+            && overflow > 0 && output == expected, "memory refused");
+}
+
+// heap that counts the blocks and bytes it holds; each block keeps its size in front of it
+struct TrackedHeap {
+    int blocks;
+    int reallocations;
+    size_t bytes;
+    size_t most;
+};
+
+static void* trackedAllocate(void* user, size_t size) {
+    TrackedHeap& heap = *(TrackedHeap*) user;
+    std::max_align_t* block = (std::max_align_t*) malloc(sizeof(std::max_align_t) + size);
+    *(size_t*) block = size;
+    ++heap.blocks;
+    heap.bytes += size;
+    heap.most = std::max(heap.most, heap.bytes);
+    return block + 1;
+}
+
+static void trackedFree(void* user, void* block) {
+    TrackedHeap& heap = *(TrackedHeap*) user;
+    std::max_align_t* start = (std::max_align_t*) block - 1;
+    --heap.blocks;
+    heap.bytes -= *(size_t*) start;
+    free(start);
+}
+
+static void* trackedReallocate(void* user, void* block, size_t size) {
+    TrackedHeap& heap = *(TrackedHeap*) user;
+    std::max_align_t* start = (std::max_align_t*) block - 1;
+    size_t oldSize = *(size_t*) start;
+    start = (std::max_align_t*) realloc(start, sizeof(std::max_align_t) + size);
+    if (!start)
+        return nullptr;
+    *(size_t*) start = size;
+    ++heap.reallocations;
+    heap.bytes += size - oldSize;
+    heap.most = std::max(heap.most, heap.bytes);
+    return start + 1;
+}
+
+// memory passed to create context holds the whole context, and is all freed when it is deleted
+static void testMemoryHooks() {
+    TrackedHeap heap {};
+    Context* context = createTestContext(CreateContext({nullptr, 0}, trackedAllocate, 
+            trackedFree, trackedReallocate, &heap));
+    addExample(createTestContour(context));
+    std::string expected, output;
+    Resolve(context, &expected);
+    int held = heap.blocks;
+    ContextMemory memory = Memory(context);
+    DeleteContext(context);
+    context = createTestContext();
+    addExample(createTestContour(context));
+    Resolve(context, &output);
+    DeleteContext(context);
+    check(held > 0 && !heap.blocks && !heap.bytes && heap.reallocations > 0 && !memory.overflow
+            && output == expected, "memory hooks");
+}
+
+// the allocate hook is never asked for memory past max bytes
+static void testMemoryCeiling() {
+    TrackedHeap heap {};
+    Context* context = createTestContext(CreateContext({nullptr, 0}, trackedAllocate, 
+            trackedFree, trackedReallocate, &heap));
+    addExample(createTestContour(context));
+    size_t contextBytes = heap.bytes - Memory(context).reserved;
+    ContextLimits limits {};
+    limits.maxBytes = Memory(context).reserved + 1024;
+    SetContextLimits(context, limits);
+    std::string output;
+    Resolve(context, &output);
+    ContextError limited = Error(context);
+    ContextMemory memory = Memory(context);
+    DeleteContext(context);
+    check(ContextError::memoryLimit == limited && memory.overflow > 0 
+            && heap.most - contextBytes <= limits.maxBytes && !heap.blocks, "memory ceiling");
+}
+
+struct MeshMeasures {
+    float area;
+    int tJunctions;  // vertices inside a triangle side instead of at its ends
+};
+
+// sums the areas of the triangles in the mesh, and counts vertices that lie within a side of a
+// triangle; triangles that meet side to side share both ends of the side
+static void meshArea(PathOutput output, const OpPoint* vertices, size_t vertexCount, 
+        const uint32_t* indices, size_t indexCount) {
+    MeshMeasures& measures = *(MeshMeasures*) output;
+    for (size_t index = 0; index + 2 < indexCount; index += 3) {
+        OpPoint a = vertices[indices[index]];
+        OpVector ab = vertices[indices[index + 1]] - a;
+        OpVector ac = vertices[indices[index + 2]] - a;
+        measures.area += std::abs(ab.cross(ac)) / 2;
+        for (size_t side = 0; side < 3; ++side) {
+            OpPoint start = vertices[indices[index + side]];
+            OpVector along = vertices[indices[index + (side + 1) % 3]] - start;
+            for (size_t vIndex = 0; vIndex < vertexCount; ++vIndex) {
+                OpVector toVertex = vertices[vIndex] - start;
+                float dot = along.dot(toVertex);
+                measures.tJunctions += dot > 0 && dot < along.dot(along)
+                        && std::abs(along.cross(toVertex)) <= OpEpsilon * along.dot(along);
+            }
+        }
+    }
+}
+
+// mesh triangles cover the result once: their area is the result's area, holes excluded; 
+// where a hole splits a span or spans merge, triangles still meet side to side
+static void testMeshArea() {
+    Context* context = createTestContext();
+    Contour* contour = createTestContour(context);
+    addRect(contour, 1, 1, 11, 16);
+    addRect(contour, 6, 12, 12, 8);  // hole, and 1 by 4 outside the first rect
+    addRect(contour, 3, 6, 5, 3);  // hole whose top and bottom are inside spans
+    SetMeshOutput(context, meshArea, .01f);
+    MeshMeasures mesh {};
+    Resolve(context, &mesh);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && OpMath::Equalish(mesh.area, 150 - 20 + 4 - 6) 
+            && !mesh.tJunctions, "mesh area");
+    const float tolerance = .001f;
+    context = createTestContext();
+    SetCurveArea(context, quadType, quadArea);
+    addExample(createTestContour(context));
+    OutputMeasures measures;
+    SetMeasureOutput(context, measured, tolerance);
+    Resolve(context, &measures);
+    SetMeasureOutput(context, nullptr, 0);
+    SetMeshOutput(context, meshArea, tolerance);
+    mesh = {};
+    Resolve(context, &mesh);
+    error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && measures.area > 0 && !mesh.tJunctions
+            && std::abs(mesh.area - measures.area) <= tolerance * measures.perimeter, 
+            "mesh curve area");
+}
+
+// a ring's area excludes its hole, and its perimeter includes the hole's edge
+static void testMeasureRing() {
+    Context* context = createTestContext();
+    Contour* contour = createTestContour(context);
+    addRect(contour, 0, 0, 10, 10);
+    addRect(contour, 3, 7, 7, 3);  // counterclockwise
+    OutputMeasures measures;
+    SetMeasureOutput(context, measured, .01f);
+    Resolve(context, &measures);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && OpMath::Equalish(measures.area, 100 - 16)
+            && OpMath::Equalish(measures.perimeter, 40 + 16) 
+            && OpRect(0, 0, 10, 10) == measures.bounds, "measure ring");
+}
+
+// flattened input resolves to lines only, with nearly the area of the curves
+static void testFlattenInput() {
+    const float tolerance = .001f;
+    Context* context = createTestContext();
+    SetCurveArea(context, quadType, quadArea);
+    addExample(createTestContour(context));
+    OutputMeasures exact;
+    SetMeasureOutput(context, measured, tolerance);
+    Resolve(context, &exact);
+    DeleteContext(context);
+    context = createTestContext();
+    SetFlattenInput(context, lineType, tolerance);
+    addExample(createTestContour(context));
+    std::string output;
+    Resolve(context, &output);
+    ContextError error = Error(context);
+    OutputMeasures flat;
+    SetMeasureOutput(context, measured, tolerance);
+    Resolve(context, &flat);
+    DeleteContext(context);
+    check(ContextError::none == error && output.find("line: ") != std::string::npos
+            && output.find("quad: ") == std::string::npos 
+            && std::abs(flat.area - exact.area) <= tolerance * exact.perimeter, "flatten input");
+}
+
+// counts output line ends, and those not on the grid
+struct GridPoints {
+    float grid;
+    int points;
+    int offGrid;
+};
+
+static void gridLineOutput(Curve c, bool , bool , PathOutput output) {
+    GridPoints& grid = *(GridPoints*) output;
+    const OpPoint* pts = (const OpPoint*) c.data;
+    for (int index = 0; index < 2; ++index) {
+        ++grid.points;
+        grid.offGrid += pts[index].x / grid.grid != std::round(pts[index].x / grid.grid)
+                || pts[index].y / grid.grid != std::round(pts[index].y / grid.grid);
+    }
+}
+
+// near misses and crossings between grid points resolve with every output point on the grid
+static void testSnapGrid() {
+    GridPoints grid { 1.f / 64, 0, 0 };
+    Context* context = createTestContext();
+    OpType gridLineType = SetCurveCallBacks(context, lineAxisRawHit, noNearly, noHull, 
+            lineIsFinite, lineIsLine, noLinear, noBounds, lineNormal, gridLineOutput, noPinCtrl, 
+            noReverse, lineTangent, linesEqual, linePtAtT, /* double not required */ linePtAtT, 
+            linePtCount, noRotate, lineSubDivide, lineXYAtT
+            OP_DEBUG_DUMP_PARAMS(noDumpCurveExtra)
+            OP_DEBUG_IMAGE_PARAMS(noAddToSkPathFunc)
+    );
+    SetSnapGrid(context, grid.grid);
+    int windingData[] = { 1 };
+    const float nearly = 1e-5f;
+    // rects whose edges miss each other by much less than the grid
+    for (int outer = 0; outer < 2; ++outer) {
+        Contour* contour = createTestContour(context);
+        AddWinding addWinding { contour, windingData, sizeof(windingData) };
+        for (int inner = 0; inner < 3; ++inner) {
+            float left = inner * 2 + outer + nearly * (inner + 1);
+            float top = outer * 3 - nearly * inner;
+            OpPoint pts[] { { left, top }, { left + 4, top }, { left + 4, top + 5 }, 
+                    { left, top + 5 }, { left, top } };
+            for (int index = 0; index < 4; ++index)
+                Add({ &pts[index], sizeof(OpPoint) * 2, gridLineType }, addWinding);
+        }
+    }
+    // triangles, apart from the rects, whose sides cross between grid points
+    Contour* contour = createTestContour(context);
+    AddWinding addWinding { contour, windingData, sizeof(windingData) };
+    OpPoint tris[][4] { { { 21, 1 }, { 27.3f, 2.1f }, { 22.2f, 6.9f }, { 21, 1 } },
+            { { 28, 7 }, { 21.7f, 4.1f }, { 26.1f, .3f }, { 28, 7 } } };
+    for (auto& tri : tris) {
+        for (int index = 0; index < 3; ++index)
+            Add({ &tri[index], sizeof(OpPoint) * 2, gridLineType }, addWinding);
+    }
+    Resolve(context, &grid);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(ContextError::none == error && grid.points > 0 && !grid.offGrid, "snap grid");
+}
+
+// double points, vectors and rects compute what float ones do, for values both represent
+static void testScalarTypes() {
+    OpPoint pts[] { { 1.5f, -2 }, { -3.25f, 4 }, { 6, .5f }, { 0, 8.75f } };
+    OpRect fBounds(pts[0].x, pts[0].y, pts[0].x, pts[0].y);
+    OpRectOf<double> dBounds(pts[0].x, pts[0].y, pts[0].x, pts[0].y);
+    bool same = true;
+    for (int index = 1; index < 4; ++index) {
+        fBounds.add(pts[index]);
+        dBounds.add(OpPointOf<double>(pts[index]));
+        OpVector fVector = pts[index] - pts[index - 1];
+        OpVectorOf<double> dVector = OpPointOf<double>(pts[index]) 
+                - OpPointOf<double>(pts[index - 1]);
+        OpVector fStart = pts[0] - OpPoint(0, 0);
+        same &= fVector.cross(fStart) == (float) dVector.cross(OpVectorOf<double>(fStart));
+        same &= fVector.dot(fVector) == (float) dVector.dot(dVector);
+        same &= OpMath::Equalish(fVector.length(), (float) dVector.length());
+        same &= OpMath::Equalish(fVector.normalize().dx, (float) dVector.normalize().dx);
+    }
+    same &= fBounds.left == dBounds.left && fBounds.top == dBounds.top 
+            && fBounds.right == dBounds.right && fBounds.bottom == dBounds.bottom;
+    same &= OpPoint(fBounds.center()) == OpPoint(dBounds.center());
+    OpRect fOther(6, 8.75f, 7, 9);  // touches a corner
+    OpRectOf<double> dOther(6, 8.75f, 7, 9);
+    same &= fBounds.intersects(fOther) && dBounds.intersects(dOther);
+    same &= !fBounds.areaOverlaps(fOther) && !dBounds.areaOverlaps(dOther);
+    check(same, "scalar types");
+}
 
+// rect union and overlap tests, which may use SIMD, return what the scalar code returns
+static void testRectSimd() {
+    OpRect rects[] { { 0, 0, 2, 2 }, { 2, 0, 4, 2 }, { 1, 1, 3, 3 }, { -0.f, 2, 0, 5 }, 
+            { 5, -1, 6, 0 }, { 1, -3, 1, 4 } };
+    constexpr int count = (int) ARRAY_COUNT(rects);
+    bool same = true;
+    for (const OpRect& a : rects) {
+        for (const OpRect& b : rects) {
+            same &= a.intersects(b) == (b.left <= a.right && a.left <= b.right 
+                    && b.top <= a.bottom && a.top <= b.bottom);
+            same &= a.areaOverlaps(b) == (b.left < a.right && a.left < b.right 
+                    && b.top < a.bottom && a.top < b.bottom);
+            OpRect u = a;
+            u.add(b);
+            same &= u == OpRect(std::min(a.left, b.left), std::min(a.top, b.top), 
+                    std::max(a.right, b.right), std::max(a.bottom, b.bottom));
+            u = a;
+            u.add(OpPoint(b.right, b.top));
+            same &= u == OpRect(std::min(a.left, b.right), std::min(a.top, b.top), 
+                    std::max(a.right, b.right), std::max(a.bottom, b.top));
+        }
+    }
+#if OP_SIMD
+    float lefts[4], tops[4], rights[4], bottoms[4];
+    for (int first = 0; first + 4 <= count; ++first) {
+        for (int index = 0; index < 4; ++index) {
+            const OpRect& r = rects[first + index];
+            lefts[index] = index == 3 ? OpNaN : r.left;  // NaN intersects nothing
+            tops[index] = r.top;
+            rights[index] = r.right;
+            bottoms[index] = r.bottom;
+        }
+        for (const OpRect& a : rects) {
+            int beyond;
+            int in = OpSimd::Intersects4(&a.left, lefts, tops, rights, bottoms, &beyond);
+            for (int index = 0; index < 4; ++index) {
+                bool scalarIn = lefts[index] <= a.right && a.left <= rights[index] 
+                        && tops[index] <= a.bottom && a.top <= bottoms[index];
+                same &= scalarIn == (0 != (in & (1 << index)));
+                same &= (a.right < lefts[index]) == (0 != (beyond & (1 << index)));
+            }
+        }
+    }
+#endif
+    check(same, "rect simd");
+}
+
+// batched points at t match points found one at a time, and resolve the same; pairs of t are
+// evaluated together, so an odd count checks the last t found alone
+static void testPtAtTBatch() {
+    float curveData[] { 2, 0, 1, 2, 0, 2, 1.5f, .5f };  // start, end, controls or weight
+    const float t[] { 0, .1f, 1.f / 3, .5f, 1, .9f, .7f };
+    constexpr size_t count = ARRAY_COUNT(t);
+    OpPoint pts[count];
+    bool same = true;
+    for (int type = 0; type < 4; ++type) {
+        size_t floats[] { 4, 6, 7, 8 };  // line, quad, conic, cubic
+        Curve curve { (CurveData*) curveData, floats[type] * sizeof(float), OpType::no };
+        void (*batch[])(Curve , const float* , OpPoint* , size_t ) { linePtAtTBatch, 
+                quadPtAtTBatch, conicPtAtTBatch, cubicPtAtTBatch };
+        OpPoint (*single[])(Curve , float ) { linePtAtT, quadPtAtT, conicPtAtT, cubicPtAtT };
+        for (size_t batchCount : { count, count - 1, (size_t) 2, (size_t) 1 }) {
+            (*batch[type])(curve, t, pts, batchCount);
+            for (size_t index = 0; index < batchCount; ++index) {
+                OpPoint expected = (*single[type])(curve, t[index]);
+                same &= !memcmp(&pts[index], &expected, sizeof(OpPoint));
+            }
+        }
+    }
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
+    std::string expected, output;
+    Resolve(context, &expected);
+    SetPtAtTBatch(context, lineType, linePtAtTBatch);
+    SetPtAtTBatch(context, quadType, quadPtAtTBatch);
+    Resolve(context, &output);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    check(same && ContextError::none == error && output == expected, "pt at t batch");
+}
+
+#if OP_SPEED_TEST
+// returns the fastest of several runs of the function, in nanoseconds per call of its body
+template<typename Function>
+static double timeBest(size_t calls, Function function) {
+    double best = OpInfinity;
+    for (int run = 0; run < 15; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / calls);
+    }
+    return best;
+}
+
+static void speedOut(std::string name, double simd, double scalar) {
+    OpDebugOut(name + ": simd " + std::to_string(simd) + " ns, scalar " + std::to_string(scalar)
+            + " ns\n");
+}
+
+// times the SIMD rect compares, rect union, and batched points at t against the scalar code
+// they replace; the scalar union is what OpRect uses, since it measured faster
+static void speedSimd() {
+    constexpr int count = 4096;
+    constexpr int pairs = 512;
+    OpArray<OpRect> rects(count);
+    OpArray<OpPoint> pts(count);
+    OpArray<float> lefts(count), tops(count), rights(count), bottoms(count);
+    unsigned seed = 1;
+    auto random = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (float) (seed >> 8 & 0xFFFF) / 655.36f;
+    };
+    for (int index = 0; index < count; ++index) {
+        float left = random();
+        float top = random();
+        rects[index] = OpRect(left, top, left + random() / 10, top + random() / 10);
+        pts[index] = { random(), random() };
+        lefts[index] = rects[index].left;
+        tops[index] = rects[index].top;
+        rights[index] = rects[index].right;
+        bottoms[index] = rects[index].bottom;
+    }
+    volatile int sink = 0;
+    auto scalarIntersects = [](const OpRect& a, const OpRect& b) {
+        return b.left <= a.right && a.left <= b.right && b.top <= a.bottom && a.top <= b.bottom;
+    };
+    double simd = timeBest(pairs * pairs, [&]() {
+        int found = 0;
+        for (int outer = 0; outer < pairs; ++outer)
+            for (int inner = 0; inner < pairs; ++inner)
+                found += rects[outer].intersects(rects[inner]);
+        sink = found;
+    });
+    double scalar = timeBest(pairs * pairs, [&]() {
+        int found = 0;
+        for (int outer = 0; outer < pairs; ++outer)
+            for (int inner = 0; inner < pairs; ++inner)
+                found += scalarIntersects(rects[outer], rects[inner]);
+        sink = found;
+    });
+    speedOut("rect intersects", simd, scalar);
+    // the rect is built from floats just before it is loaded as a vector
+    simd = timeBest(count - 1, [&]() {
+        int found = 0;
+        for (int index = 0; index + 1 < count; ++index) {
+            OpRect built(pts[index].x, pts[index].y, pts[index + 1].x + 1, pts[index + 1].y + 1);
+            found += built.intersects(rects[index]);
+        }
+        sink = found;
+    });
+    scalar = timeBest(count - 1, [&]() {
+        int found = 0;
+        for (int index = 0; index + 1 < count; ++index) {
+            OpRect built(pts[index].x, pts[index].y, pts[index + 1].x + 1, pts[index + 1].y + 1);
+            found += scalarIntersects(built, rects[index]);
+        }
+        sink = found;
+    });
+    speedOut("built rect intersects", simd, scalar);
+#if OP_SIMD
+    simd = timeBest(pairs * count, [&]() {
+        int found = 0;
+        for (int outer = 0; outer < pairs; ++outer) {
+            for (int inner = 0; inner < count; inner += 4) {
+                int beyond;
+                found += OpSimd::Intersects4(&rects[outer].left, &lefts[inner], &tops[inner],
+                        &rights[inner], &bottoms[inner], &beyond);
+            }
+        }
+        sink = found;
+    });
+    scalar = timeBest(pairs * count, [&]() {
+        int found = 0;
+        for (int outer = 0; outer < pairs; ++outer)
+            for (int inner = 0; inner < count; ++inner)
+                found += scalarIntersects(rects[outer], rects[inner]);
+        sink = found;
+    });
+    speedOut("four rects intersect", simd, scalar);
+    // each union loads and stores the rect, as a SIMD version of OpRect::add would
+    simd = timeBest(count, [&]() {
+        OpRect bounds = rects[0];
+        for (const OpRect& rect : rects)
+            OpSimd::Store(&bounds.left, OpSimd::Union(OpSimd::Load(&bounds.left), 
+                    OpSimd::Load(&rect.left)));
+        sink = (int) bounds.right;
+    });
+    scalar = timeBest(count, [&]() {
+        OpRect bounds = rects[0];
+        for (const OpRect& rect : rects) {
+            bounds.left = std::min(bounds.left, rect.left);
+            bounds.top = std::min(bounds.top, rect.top);
+            bounds.right = std::max(bounds.right, rect.right);
+            bounds.bottom = std::max(bounds.bottom, rect.bottom);
+        }
+        sink = (int) bounds.right;
+    });
+    speedOut("rect union", simd, scalar);
+#endif
+    float quad[] { 2, 0, 1, 2, 0, 2 };
+    float cubic[] { 2, 0, 1, 2, 0, 2, 1.5f, .5f };
+    float ts[] { .25f, .75f };
+    OpPoint pair[2];
+    for (int type = 0; type < 2; ++type) {
+        Curve curve { (CurveData*) (type ? cubic : quad), (type ? 8 : 6) * sizeof(float), 
+                OpType::no };
+        simd = timeBest(count, [&]() {
+            for (int index = 0; index < count; ++index) {
+                ts[0] = pts[index].x / 100;
+                (type ? cubicPtAtTBatch : quadPtAtTBatch)(curve, ts, pair, 2);
+                sink = (int) pair[1].x;
+            }
+        });
+        scalar = timeBest(count, [&]() {
+            for (int index = 0; index < count; ++index) {
+                ts[0] = pts[index].x / 100;
+                for (int pt = 0; pt < 2; ++pt)
+                    pair[pt] = (type ? cubicPtAtT : quadPtAtT)(curve, ts[pt]);
+                sink = (int) pair[1].x;
+            }
+        });
+        speedOut(type ? "cubic pt at t pair" : "quad pt at t pair", simd, scalar);
+    }
+}
+#endif
+
+// float roots are kept only if they match the double roots to within a few epsilon
+static bool sameRoots(OpRoots floatRoots, OpRoots doubleRoots) {
+    if (floatRoots.count != doubleRoots.count)
+        return false;
+    for (unsigned index = 0; index < floatRoots.count; ++index) {
+        float root = floatRoots.roots[index];
+        bool found = false;
+        for (unsigned dIndex = 0; dIndex < doubleRoots.count; ++dIndex) {
+            float expected = doubleRoots.roots[dIndex];
+            found |= fabsf(root - expected) <= 8 * OpEpsilon * std::max(1.f, fabsf(expected));
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
+
+// returns true if the polynomial was solved in float, and false if it fell back to double
+static bool solvedInFloat(OpRoots roots, OpRootCounts before, bool* same, OpRoots expected) {
+    *same &= sameRoots(roots.keepValidTs(), expected.keepValidTs());
+    OP_ASSERT(OpMath::RootCounts.floatPath + OpMath::RootCounts.doublePath 
+            == before.floatPath + before.doublePath + 1);
+    return OpMath::RootCounts.floatPath > before.floatPath;
+}
+
+static void cubicOutput(Curve , bool , bool , PathOutput ) {
+}
+
+// well separated roots are certified in float, including those outside zero to one; nearly
+// equal roots fall back to double; callers documented as needing double still get it
+static void testRoots() {
+    bool same = true;
+    bool certified = true;
+    OpRootCounts before = OpMath::RootCounts;
+    certified &= solvedInFloat(OpMath::QuadRoots(3, -3, .5625f), before, &same,
+            OpMath::QuadRootsDouble(3, -3, .5625f));  // roots .25, .75
+    before = OpMath::RootCounts;
+    certified &= solvedInFloat(OpMath::QuadRoots(2, -31, 15), before, &same,
+            OpMath::QuadRootsDouble(2, -31, 15));  // roots .5, 15
+    before = OpMath::RootCounts;
+    certified &= solvedInFloat(OpMath::CubicRoots(1, -1.5, -5.5, 3, MatchEnds::none), before,
+            &same, OpMath::CubicRootsReal(1, -1.5, -5.5, 3, MatchEnds::none));  // .5, 3, -2
+    before = OpMath::RootCounts;
+    bool fallback = !solvedInFloat(OpMath::QuadRoots(1, -1.0000001f, .25000003f), before, &same,
+            OpMath::QuadRootsDouble(1, -1.0000001f, .25000003f));  // nearly double root at .5
+    before = OpMath::RootCounts;
+    fallback &= !solvedInFloat(OpMath::CubicRoots(1, -1.5, .75, -.125, MatchEnds::none), before,
+            &same, OpMath::CubicRootsReal(1, -1.5, .75, -.125, MatchEnds::none));  // triple .5
+    // loop9: extrema of cubic (3, 0, -2/3, 1); comment requires double, so counts don't change
+    before = OpMath::RootCounts;
+    OpRoots loop9 = OpMath::QuadRootsInteriorT(9, 0, -2.f / 3);
+    bool doubleKept = before.floatPath == OpMath::RootCounts.floatPath
+            && before.doublePath == OpMath::RootCounts.doublePath
+            && sameRoots(loop9, OpMath::QuadRootsDouble(9, 0, -2.f / 3).keepInteriorTs());
+    // thread_loops542: cubic with a tiny cubic term; the root near 1.4 must not become 1
+    OpRoots loops542 = OpMath::CubicRootsReal(4.7683715820312500e-07, 13.614606857299805,
+            -19.172750473022461, 0, MatchEnds::none);
+    bool found542 = false;
+    for (unsigned index = 0; index < loops542.count; ++index)
+        found542 |= fabsf(loops542.roots[index] - 1.40826f) < .0001f;
+    doubleKept &= found542 && before.floatPath == OpMath::RootCounts.floatPath
+            && before.doublePath == OpMath::RootCounts.doublePath;
+    // a resolve with cubics reports the roots it solved on this thread in its counts
+    Context* context = createTestContext();
+    OpType cubicType = SetCurveCallBacks(context, cubicAxisRawHit, cubicNearly, cubicHull, 
+            cubicIsFinite, cubicIsLine, 
+            cubicIsLinear, cubicSetBounds, cubicNormal, cubicOutput, cubicPinCtrl, cubicReverse,
+            cubicTangent, cubicsEqual, cubicPtAtT, /* double not required */ cubicPtAtT, 
+            cubicPtCount, cubicRotate, cubicSubDivide, cubicXYAtT
+            OP_DEBUG_DUMP_PARAMS(noDumpCurveExtra)
+            OP_DEBUG_IMAGE_PARAMS(noAddToSkPathFunc)
+    );
+    Contour* contour = createTestContour(context);
+    int windingData[] = { 1 };
+    AddWinding addWinding { contour, windingData, sizeof(windingData) };
+    OpPoint cubic[] { { 0, 0 }, { 4, 0 }, { 1, 3 }, { 3, 3 } };  // start, end, controls
+    OpPoint line[] { { 4, 0 }, { 0, 0 } };
+    AddCubics({ cubic, sizeof(cubic), cubicType }, addWinding);
+    Add({ line, sizeof(line), lineType }, addWinding);
+    addRect(contour, 1, 1, 5, 4);
+    before = OpMath::RootCounts;
+    std::string output;
+    Resolve(context, &output);
+    ContextCounts counts = Counts(context);
+    ContextError error = Error(context);
+    DeleteContext(context);
+    bool countsMatch = counts.floatRoots > 0 
+            && counts.floatRoots == OpMath::RootCounts.floatPath - before.floatPath
+            && counts.doubleRoots == OpMath::RootCounts.doublePath - before.doublePath;
+    check(same && certified && fallback && doubleKept && ContextError::none == error 
+            && countsMatch, "roots");
+}
+
+// small arrays keep their entries in place until they grow past N, and keep them in order
+// through insert, take, reserve, and copy and move assignment
+static void testSmallArray() {
+    typedef OpSmallArray<int, 2> Small;
+    auto equals = [](const Small& a, std::vector<int> expected) {
+        return a.size() == expected.size() 
+                && std::equal(a.begin(), a.end(), expected.begin());
+    };
+    bool ok = true;
+    Small a;
+    a.push_back(1);
+    a.push_back(2);
+    ok &= !a.spilled() && equals(a, { 1, 2 });
+    a.insert(a.begin(), a.back());  // entry is in the array, which spills as it grows
+    ok &= a.spilled() && equals(a, { 2, 1, 2 });
+    a.insert(a.end(), a.front());  // entry is in the spilled array
+    a.insert(a.begin() + 1, a[3]);
+    ok &= equals(a, { 2, 2, 1, 2, 2 });
+    Small b;
+    b.reserve(2);
+    ok &= !b.spilled();
+    b.push_back(7);
+    b.reserve(5);
+    ok &= b.spilled() && b.capacity >= 5 && equals(b, { 7 });
+    Small c;
+    c.push_back(9);
+    const int* spilledItems = a.data();
+    c.take(a);  // spilled: c takes a's storage, replacing its own entries
+    ok &= c.data() == spilledItems && equals(c, { 2, 2, 1, 2, 2 }) && a.empty() && !a.spilled();
+    a.push_back(3);
+    c.take(a);  // in place: c copies a's entries into its own storage
+    ok &= !c.spilled() && equals(c, { 3 }) && a.empty();
+    a = b;  // copy of spilled into in place
+    ok &= equals(a, { 7 }) && equals(b, { 7 });
+    b = c;  // copy of in place into spilled
+    ok &= equals(b, { 3 });
+    Small& self = b;
+    b = self;
+    ok &= equals(b, { 3 });
+    a.push_back(4);
+    a.push_back(5);
+    spilledItems = a.data();
+    c = std::move(a);  // move of spilled
+    ok &= c.data() == spilledItems && equals(c, { 7, 4, 5 }) && a.empty();
+    b = std::move(c);  // move of spilled into spilled
+    ok &= b.data() == spilledItems && equals(b, { 7, 4, 5 }) && c.empty();
+    a.push_back(6);
+    b = std::move(a);  // move of in place frees b's spilled storage
+    ok &= !b.spilled() && equals(b, { 6 }) && a.empty();
+    Small d(b);
+    Small e(std::move(d));
+    ok &= equals(e, { 6 }) && d.empty();
+    check(ok, "small array");
+}
+
+void testNewInterface() {
+    Context* context = createTestContext();
+    addExample(createTestContour(context));
     Resolve(context, nullptr);
+    ContextError error = Error(context);
     DeleteContext(context);
 
-    if (Error(context)) {
+    if (ContextError::none != error) {
         exit(1);
     }
+    testResolveTwice();
+    testResolveAsync();
+    testResolveAsyncDelete();
+    testOutputDone();
+    testResolveStep();
+    testEndSnap();
+    testLimits();
+    testTimeLimitAndCancel();
+    testCoverageHole();
+    testContainsHole();
+    testNesting();
+    testMemoryRefused();
+    testMemoryHooks();
+    testMemoryCeiling();
+    testMeshArea();
+    testMeasureRing();
+    testFlattenInput();
+    testSnapGrid();
+    testScalarTypes();
+    testRectSimd();
+    testPtAtTBatch();
+    testSmallArray();
+    testRoots();
+#if OP_SPEED_TEST
+    speedSimd();
+#endif
 }